@@ -26,9 +26,13 @@
 #define CPPCODEC_DETAIL_DATA_ACCESS
 
 #include <stdint.h> // for size_t
+#include <string.h> // for memcpy()
+#include <cstddef> // for std::nullptr_t
+#include <memory> // for std::allocator, std::allocator_traits
+#include <new> // for placement new
 #include <string> // for static_assert() checking that string will be optimized
 #include <type_traits> // for std::enable_if, std::remove_reference, and such
-#include <utility> // for std::declval
+#include <utility> // for std::declval, std::forward
 #include <vector> // for static_assert() checking that vector will be optimized
 
 #include "../detail/config.hpp" // for CPPCODEC_ALWAYS_INLINE
@@ -41,6 +45,15 @@ namespace data {
 // the default type requirements:
 // For result types: init(Result&, ResultState&, size_t capacity),
 //     put(Result&, ResultState&, char), finish(Result&, State&)
+// For result types used with encode_append()/decode_append():
+//     init_append(Result&, ResultState&, size_t capacity)
+// For result types used with decode_append() or the incremental decoder, which drop the bytes
+//     of a failed call instead of finishing it: truncate(Result&, ResultState&, size_t size)
+// Optionally for result types with direct data or array access, to skip initializing
+//     elements that will be overwritten anyway: resize_uninitialized(Result&, size_t)
+// Optionally for result types, to write many characters at once instead of calling put():
+//     reserve_span(Result&, ResultState&, size_t num_chars) & commit(Result&, ResultState&, size_t),
+//     or an append(const char*, size_t) member function for results with an empty_result_state
 // For const (read-only) types: char_data(const T&)
 // For both const and result types: size(const T&)
 
@@ -79,12 +92,27 @@ CPPCODEC_ALWAYS_INLINE void init(Result& result, empty_result_state&, size_t cap
     result.reserve(capacity);
 }
 
+// Like init(), but keeps the current contents and puts new characters after them.
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void init_append(Result& result, empty_result_state&, size_t capacity)
+{
+    result.reserve(result.size() + capacity);
+}
+
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void finish(Result&, empty_result_state&)
 {
     // Default is to push_back(), which already increases the size.
 }
 
+// Ends the result state like finish(), but only keeps the first size characters of the result,
+// e.g. the contents that were there before init_append().
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void truncate(Result& result, empty_result_state&, size_t size)
+{
+    result.resize(size);
+}
+
 // For the put() default implementation, we try calling push_back() with either uint8_t or char,
 // whichever compiles. Scary-fancy template magic from http://stackoverflow.com/a/1386390.
 namespace fallback {
@@ -121,6 +149,63 @@ CPPCODEC_ALWAYS_INLINE void put(Result& result, empty_result_state&, uint8_t c)
     put_impl<sizeof(fallback::flag(), put_uint8(result, c), fallback::flag()) != 1>::put(result, c);
 }
 
+// Writable memory for the next num_chars characters of the result, or nullptr if the
+// result state only supports put(). Call commit() after writing to (part of) the span.
+// Like put(), this relies on the capacity passed to init() and doesn't grow the result.
+// Overloads return char*, this fallback std::nullptr_t so that has_span() can tell them apart.
+template <typename Result, typename ResultState>
+CPPCODEC_ALWAYS_INLINE std::nullptr_t reserve_span(Result&, ResultState&, size_t)
+{
+    return nullptr;
+}
+
+// Adds the first num_chars characters of the span from reserve_span() to the result.
+template <typename Result, typename ResultState>
+CPPCODEC_ALWAYS_INLINE void commit(Result&, ResultState&, size_t)
+{
+}
+
+// For put_span(), with results that neither provide a span nor any other way of
+// adding several characters at once.
+template <typename T>
+constexpr auto has_append(T* t) -> decltype(t->append(static_cast<const char*>(nullptr), size_t(0)), bool())
+{
+    return (void)t, true;
+}
+constexpr bool has_append(...) { return false; }
+
+template <bool> struct put_span_impl;
+template <> struct put_span_impl<true> { // append() available
+    template <typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE void put_span(Result& result, ResultState&, const char* src, size_t num_chars)
+    {
+        result.append(src, num_chars);
+    }
+};
+template <> struct put_span_impl<false> { // append() not available
+    template <typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE void put_span(Result& result, ResultState& state, const char* src, size_t num_chars)
+    {
+        for (size_t i = 0; i < num_chars; ++i) {
+            put(result, state, src[i]);
+        }
+    }
+};
+
+// Writes num_chars characters at once: into the span from reserve_span() if there is one,
+// otherwise with append() for push_back() style results, or one put() at a time.
+template <typename Result, typename ResultState>
+CPPCODEC_ALWAYS_INLINE void put_span(Result& result, ResultState& state, const char* src, size_t num_chars)
+{
+    if (char* dst = reserve_span(result, state, num_chars)) {
+        memcpy(dst, src, num_chars);
+        commit(result, state, num_chars);
+        return;
+    }
+    put_span_impl<std::is_same<ResultState, empty_result_state>::value
+            && has_append(static_cast<Result*>(nullptr))>::put_span(result, state, src, num_chars);
+}
+
 //
 // Specialization for container types with direct mutable data access,
 // e.g. std::vector<uint8_t>.
@@ -134,6 +219,52 @@ CPPCODEC_ALWAYS_INLINE void put(Result& result, empty_result_state&, uint8_t c)
 // (result & state) can be added to tailor it to that particular result type.
 //
 
+// Sets the size of a result before the codec writes to it, after which its contents are
+// overwritten up to the final size. New elements may therefore remain uninitialized.
+// Overload this for your own result type (in its namespace or in cppcodec::data)
+// if it can grow without initializing elements.
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void resize_uninitialized(Result& result, size_t size)
+{
+    result.resize(size);
+}
+
+#if defined(__cpp_lib_string_resize_and_overwrite)
+template <typename CharT, typename Traits, typename Alloc>
+CPPCODEC_ALWAYS_INLINE void resize_uninitialized(std::basic_string<CharT, Traits, Alloc>& result, size_t size)
+{
+    result.resize_and_overwrite(size, [](CharT*, size_t n) noexcept { return n; });
+}
+#endif
+
+// Allocator adaptor that default-initializes elements instead of value-initializing them,
+// so that resize() doesn't zero-fill e.g. a std::vector<uint8_t, default_init_allocator<uint8_t>>.
+template <typename T, typename Alloc = std::allocator<T>>
+class default_init_allocator : public Alloc
+{
+    using traits = std::allocator_traits<Alloc>;
+
+public:
+    template <typename U>
+    struct rebind {
+        using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    using Alloc::Alloc;
+    default_init_allocator() = default;
+
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args)
+    {
+        traits::construct(static_cast<Alloc&>(*this), ptr, std::forward<Args>(args)...);
+    }
+};
+
 template <typename T>
 constexpr auto data_is_mutable(T* t) -> decltype(t->data()[size_t(0)] = 'x', bool())
 {
@@ -151,7 +282,7 @@ public:
         // and it isn't guaranteed that it will be untouched upon the
         //.next resize(). In that light, resize from the start and
         // slightly reduce the size at the end if necessary.
-        result.resize(capacity);
+        resize_uninitialized(result, capacity);
 
         // result.data() may perform a calculation to retrieve the address.
         // E.g. std::string (since C++11) will use small string optimization,
@@ -161,14 +292,33 @@ public:
         // Conditional code paths are slow so we only do it once, at the start.
         m_buffer = result.data();
     }
+    CPPCODEC_ALWAYS_INLINE void init_append(Result& result, size_t capacity)
+    {
+        m_offset = result.size();
+        resize_uninitialized(result, m_offset + capacity);
+        m_buffer = result.data();
+    }
     CPPCODEC_ALWAYS_INLINE void put(Result&, char c)
     {
         m_buffer[m_offset++] = c;
     }
+    CPPCODEC_ALWAYS_INLINE char* reserve_span(Result&)
+    {
+        return reinterpret_cast<char*>(m_buffer + m_offset);
+    }
+    CPPCODEC_ALWAYS_INLINE void commit(Result&, size_t num_chars)
+    {
+        m_offset += num_chars;
+    }
     CPPCODEC_ALWAYS_INLINE void finish(Result& result)
     {
         result.resize(m_offset);
     }
+    CPPCODEC_ALWAYS_INLINE void truncate(Result& result, size_t size)
+    {
+        m_offset = size;
+        result.resize(m_offset);
+    }
     CPPCODEC_ALWAYS_INLINE size_t size(const Result&)
     {
         return m_offset;
@@ -199,25 +349,57 @@ static_assert(std::is_same<
         direct_data_access_result_state<std::vector<uint8_t>>>::value,
         "std::vector<uint8_t> must be handled by direct_data_access_result_state");
 
-// Specialized init(), put() and finish() functions for direct_data_access_result_state.
+static_assert(std::is_same<
+        decltype(create_state(*static_cast<std::vector<uint8_t, default_init_allocator<uint8_t>>*>(nullptr),
+                specific_t())),
+        direct_data_access_result_state<std::vector<uint8_t, default_init_allocator<uint8_t>>>>::value,
+        "std::vector<uint8_t, default_init_allocator> must be handled by direct_data_access_result_state");
+
+// Specialized init(), put(), finish() and truncate() functions for direct_data_access_result_state.
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void init(Result& result, direct_data_access_result_state<Result>& state, size_t capacity)
 {
     state.init(result, capacity);
 }
 
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void init_append(Result& result, direct_data_access_result_state<Result>& state, size_t capacity)
+{
+    state.init_append(result, capacity);
+}
+
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void put(Result& result, direct_data_access_result_state<Result>& state, char c)
 {
     state.put(result, c);
 }
 
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE char* reserve_span(
+        Result& result, direct_data_access_result_state<Result>& state, size_t)
+{
+    return state.reserve_span(result);
+}
+
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void commit(
+        Result& result, direct_data_access_result_state<Result>& state, size_t num_chars)
+{
+    state.commit(result, num_chars);
+}
+
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void finish(Result& result, direct_data_access_result_state<Result>& state)
 {
     state.finish(result);
 }
 
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void truncate(Result& result, direct_data_access_result_state<Result>& state, size_t size)
+{
+    state.truncate(result, size);
+}
+
 //
 // Specialization for container types with direct mutable array access,
 // e.g. std::string. This is generally faster because bound checks are
@@ -245,16 +427,34 @@ public:
         // and it isn't guaranteed that it will be untouched upon the
         //.next resize(). In that light, resize from the start and
         // slightly reduce the size at the end if necessary.
-        result.resize(capacity);
+        resize_uninitialized(result, capacity);
+    }
+    CPPCODEC_ALWAYS_INLINE void init_append(Result& result, size_t capacity)
+    {
+        m_offset = result.size();
+        resize_uninitialized(result, m_offset + capacity);
     }
     CPPCODEC_ALWAYS_INLINE void put(Result& result, char c)
     {
         result[m_offset++] = c;
     }
+    CPPCODEC_ALWAYS_INLINE char* reserve_span(Result& result)
+    {
+        return reinterpret_cast<char*>(&result[m_offset]);
+    }
+    CPPCODEC_ALWAYS_INLINE void commit(Result&, size_t num_chars)
+    {
+        m_offset += num_chars;
+    }
     CPPCODEC_ALWAYS_INLINE void finish(Result& result)
     {
         result.resize(m_offset);
     }
+    CPPCODEC_ALWAYS_INLINE void truncate(Result& result, size_t size)
+    {
+        m_offset = size;
+        result.resize(m_offset);
+    }
     CPPCODEC_ALWAYS_INLINE size_t size(const Result&)
     {
         return m_offset;
@@ -288,25 +488,66 @@ static_assert(std::is_same<
         "std::string (pre-C++17) must be handled by array_access_result_state");
 #endif
 
-// Specialized init(), put() and finish() functions for array_access_result_state.
+// Specialized init(), put(), finish() and truncate() functions for array_access_result_state.
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void init(Result& result, array_access_result_state<Result>& state, size_t capacity)
 {
     state.init(result, capacity);
 }
 
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void init_append(Result& result, array_access_result_state<Result>& state, size_t capacity)
+{
+    state.init_append(result, capacity);
+}
+
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void put(Result& result, array_access_result_state<Result>& state, char c)
 {
     state.put(result, c);
 }
 
+// Only strings are known to store their characters contiguously, other containers
+// with operator[] (e.g. std::deque) stick with put().
+template <typename CharT, typename Traits, typename Alloc>
+CPPCODEC_ALWAYS_INLINE char* reserve_span(std::basic_string<CharT, Traits, Alloc>& result,
+        array_access_result_state<std::basic_string<CharT, Traits, Alloc>>& state, size_t)
+{
+    return state.reserve_span(result);
+}
+
+template <typename CharT, typename Traits, typename Alloc>
+CPPCODEC_ALWAYS_INLINE void commit(std::basic_string<CharT, Traits, Alloc>& result,
+        array_access_result_state<std::basic_string<CharT, Traits, Alloc>>& state, size_t num_chars)
+{
+    state.commit(result, num_chars);
+}
+
 template <typename Result>
 CPPCODEC_ALWAYS_INLINE void finish(Result& result, array_access_result_state<Result>& state)
 {
     state.finish(result);
 }
 
+template <typename Result>
+CPPCODEC_ALWAYS_INLINE void truncate(Result& result, array_access_result_state<Result>& state, size_t size)
+{
+    state.truncate(result, size);
+}
+
+// Whether reserve_span() is overloaded for the result's state, known before init().
+// It may still return nullptr at runtime, e.g. for a custom state without storage.
+template <typename Result>
+constexpr bool has_span()
+{
+    return !std::is_same<decltype(reserve_span(std::declval<Result&>(),
+            std::declval<decltype(create_state(std::declval<Result&>(), specific_t()))&>(), size_t(0))),
+            std::nullptr_t>::value;
+}
+
+static_assert(has_span<std::vector<uint8_t>>() && has_span<std::string>(),
+        "std::vector<uint8_t> and std::string must provide spans");
+
 // char_data() is only used to read, not for result buffers.
 template <typename T> inline const char* char_data(const T& t)
 {
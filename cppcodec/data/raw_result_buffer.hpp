@@ -44,6 +44,7 @@ public:
     CPPCODEC_ALWAYS_INLINE void push_back(char c) { *m_ptr = c; ++m_ptr; }
     CPPCODEC_ALWAYS_INLINE size_t size() const { return m_ptr - m_begin; }
     CPPCODEC_ALWAYS_INLINE void resize(size_t size) { m_ptr = m_begin + size; }
+    CPPCODEC_ALWAYS_INLINE char* end() { return m_ptr; }
 
 private:
     char* m_ptr;
@@ -64,6 +65,17 @@ template <> inline void init<raw_result_buffer>(
 }
 template <> inline void finish<raw_result_buffer>(raw_result_buffer&, empty_result_state&) { }
 
+// init() has already checked that there is enough room for all characters.
+inline char* reserve_span(raw_result_buffer& result, empty_result_state&, size_t)
+{
+    return result.end();
+}
+template <> inline void commit<raw_result_buffer>(
+        raw_result_buffer& result, empty_result_state&, size_t num_chars)
+{
+    result.resize(result.size() + num_chars);
+}
+
 } // namespace data
 } // namespace cppcodec
 
@@ -36,6 +36,7 @@
 
 #include "../data/access.hpp"
 #include "../parse_error.hpp"
+#include "base32_simd.hpp"
 #include "config.hpp"
 #include "stream_codec.hpp"
 
@@ -97,6 +98,18 @@ public:
         throw std::domain_error("invalid last encoding symbol index in a tail");
     }
 
+    // Error message if a last block can't have idx_len symbols, nullptr if decode_tail() accepts it.
+    static CPPCODEC_ALWAYS_INLINE constexpr const char* invalid_tail_size(size_t idx_len) noexcept
+    {
+        return (idx_len == 1)
+                ? "invalid number of symbols in last base32 block: found 1, expected 2, 4, 5 or 7"
+                : (idx_len == 3)
+                ? "invalid number of symbols in last base32 block: found 3, expected 2, 4, 5 or 7"
+                : (idx_len == 6)
+                ? "invalid number of symbols in last base32 block: found 6, expected 2, 4, 5 or 7"
+                : nullptr;
+    }
+
     template <typename Result, typename ResultState>
     static CPPCODEC_ALWAYS_INLINE void decode_block(
             Result& decoded, ResultState&, const alphabet_index_t* idx);
@@ -128,18 +141,7 @@ template <typename Result, typename ResultState>
 CPPCODEC_ALWAYS_INLINE void base32<CodecVariant>::decode_tail(
         Result& decoded, ResultState& state, const alphabet_index_t* idx, size_t idx_len)
 {
-    if (idx_len == 1) {
-        throw invalid_input_length(
-                "invalid number of symbols in last base32 block: found 1, expected 2, 4, 5 or 7");
-    }
-    if (idx_len == 3) {
-        throw invalid_input_length(
-                "invalid number of symbols in last base32 block: found 3, expected 2, 4, 5 or 7");
-    }
-    if (idx_len == 6) {
-        throw invalid_input_length(
-                "invalid number of symbols in last base32 block: found 6, expected 2, 4, 5 or 7");
-    }
+    // idx_len == 1, 3 or 6 has been rejected by invalid_tail_size().
 
     // idx_len == 2: decoded size 1
     put(decoded, state, static_cast<uint8_t>(((idx[0] << 3) & 0xF8) | ((idx[1] >> 2) & 0x7)));
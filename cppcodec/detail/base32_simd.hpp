@@ -0,0 +1,531 @@
+/**
+ *  Copyright (C) 2026 agent
+ *  All rights reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ */
+
+#ifndef CPPCODEC_DETAIL_BASE32_SIMD
+#define CPPCODEC_DETAIL_BASE32_SIMD
+
+#include <stdint.h>
+#include <string.h> // for memcpy(), memmove()
+
+#include "config.hpp"
+#include "stream_codec.hpp"
+#include "swar.hpp"
+
+#if CPPCODEC_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace cppcodec {
+namespace detail {
+
+template <typename CodecVariant> class base32;
+
+// Classifies ASCII characters for the vector decoder, derived from the scalar lookup table
+// so that case folding and other symbol normalization (e.g. Crockford's O -> 0) match.
+template <typename CodecVariant>
+struct base32_symbol_table
+{
+    static constexpr const uint8_t ignored = 0x40; // CodecVariant::should_ignore()
+    static constexpr const uint8_t special = 0x80; // anything for the scalar decoder to handle
+
+    base32_symbol_table()
+    {
+        using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+        for (size_t c = 0; c < sizeof(index); ++c) {
+            alphabet_index_t idx = alphabet_index_lookup::for_symbol(static_cast<char>(c));
+            index[c] = CodecVariant::should_ignore(static_cast<char>(c)) ? ignored
+                    : alphabet_index_info<CodecVariant>::is_stop_character(idx) ? special
+                    : static_cast<uint8_t>(idx);
+        }
+        for (size_t c = 0; c < sizeof(index); ++c) {
+            if (index[c] < 32) {
+                symbol_bits[c & 0xF] = static_cast<uint8_t>(symbol_bits[c & 0xF] | (1u << (c >> 4)));
+            }
+        }
+    }
+
+    static const base32_symbol_table& instance()
+    {
+        static const base32_symbol_table table;
+        return table;
+    }
+
+    alignas(16) uint8_t index[128];
+
+    // Bit h of symbol_bits[l] is set if character (h << 4 | l) is an alphabet symbol,
+    // for scanning without computing the indexes.
+    alignas(16) uint8_t symbol_bits[16] = {};
+};
+
+// Shuffle patterns to move the non-ignored bytes of an 8-byte group to its front.
+struct compaction_table
+{
+    compaction_table()
+    {
+        for (size_t mask = 0; mask < 256; ++mask) {
+            uint8_t num_kept = 0;
+            for (uint8_t i = 0; i < 8; ++i) {
+                if (!(mask & (1u << i))) {
+                    shuffle[mask][num_kept++] = i;
+                }
+            }
+            kept[mask] = num_kept;
+            for (uint8_t i = num_kept; i < 8; ++i) {
+                shuffle[mask][i] = 0x80;
+            }
+        }
+    }
+
+    static const compaction_table& instance()
+    {
+        static const compaction_table table;
+        return table;
+    }
+
+    alignas(8) uint8_t shuffle[256][8];
+    uint8_t kept[256];
+};
+
+// Scalar tier.
+template <typename CodecVariant>
+class base32_swar
+{
+public:
+    // Encodes 5 bytes into 8 symbols per iteration, with one 64-bit load and store each.
+    static inline size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+
+        // Each iteration loads 8 bytes, but only encodes 5 of them.
+        for (; src_end - src >= 8; src += 5, dst += 8) {
+            swar_store_le64(dst, swar_symbols<CodecVariant, 5>(swar_load_be64(src)));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+};
+
+#if CPPCODEC_X86_SIMD
+
+// Appends the indices that are not marked as ignored (one bit per byte in ignored) to dst,
+// returns their number. Writes up to 8 bytes past the last appended index.
+CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 size_t base32_compact(
+        uint8_t* dst, __m128i indices, uint32_t ignored)
+{
+    const compaction_table& compaction = compaction_table::instance();
+    uint8_t* const dst_begin = dst;
+
+    for (size_t i = 0; i < 2; ++i) {
+        uint32_t mask = (ignored >> (i * 8)) & 0xFF;
+        const __m128i group = i ? _mm_srli_si128(indices, 8) : indices;
+        const __m128i shuffle = _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(compaction.shuffle[mask]));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(group, shuffle));
+        dst += compaction.kept[mask];
+    }
+    return static_cast<size_t>(dst - dst_begin);
+}
+
+// Steps back over the last num_symbols alphabet symbols before src (and any ignored
+// characters in between), so that symbols which didn't make up a whole vector remain unconsumed.
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE const char* base32_unconsume(const char* src, size_t num_symbols)
+{
+    while (num_symbols) {
+        --src;
+        if (!CodecVariant::should_ignore(*src)) {
+            --num_symbols;
+        }
+    }
+    return src;
+}
+
+template <typename CodecVariant>
+class base32_sse41
+{
+public:
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i alphabet(alphabet_index_t first)
+    {
+        return _mm_setr_epi8(
+                CodecVariant::symbol(first + 0), CodecVariant::symbol(first + 1),
+                CodecVariant::symbol(first + 2), CodecVariant::symbol(first + 3),
+                CodecVariant::symbol(first + 4), CodecVariant::symbol(first + 5),
+                CodecVariant::symbol(first + 6), CodecVariant::symbol(first + 7),
+                CodecVariant::symbol(first + 8), CodecVariant::symbol(first + 9),
+                CodecVariant::symbol(first + 10), CodecVariant::symbol(first + 11),
+                CodecVariant::symbol(first + 12), CodecVariant::symbol(first + 13),
+                CodecVariant::symbol(first + 14), CodecVariant::symbol(first + 15));
+    }
+
+    // Encodes two 5-byte blocks into 16 symbols per iteration, see base32_avx2::encode().
+    static CPPCODEC_TARGET_SSE41 size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+
+        const __m128i spread_even = _mm_setr_epi8(1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 4, 4);
+        const __m128i spread_odd = _mm_setr_epi8(6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 9, 9);
+        const __m128i shifts = _mm_setr_epi16(
+                1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8);
+        const __m128i mask = _mm_set1_epi16(0x1F);
+
+        // Each iteration loads 16 bytes, but only encodes 10 of them.
+        for (; src_end - src >= 16; src += 10, dst += 16) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i even = _mm_and_si128(_mm_mulhi_epu16(
+                    _mm_shuffle_epi8(in, spread_even), shifts), mask);
+            const __m128i odd = _mm_and_si128(_mm_mulhi_epu16(
+                    _mm_shuffle_epi8(in, spread_odd), shifts), mask);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), symbols(_mm_packus_epi16(even, odd)));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+    // Decodes 16 symbols into 10 bytes per iteration, see base32_avx2::decode().
+    static CPPCODEC_TARGET_SSE41 size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        using symbol_table = base32_symbol_table<CodecVariant>;
+        const uint8_t* table = symbol_table::instance().index;
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        __m128i rows[6];
+        for (size_t i = 0; i < 6; ++i) {
+            rows[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(table + 16 * (i + 2)));
+        }
+
+        uint8_t pending[16 + 16 + 8];
+        size_t num_pending = 0;
+
+        for (; src_end - src >= 16; src += 16) {
+            const __m128i indices = indices_for(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), rows);
+            if (_mm_movemask_epi8(indices)) {
+                break;
+            }
+            uint32_t ignored = static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(indices, _mm_set1_epi8(symbol_table::ignored))));
+
+            if (!ignored && !num_pending) {
+                decode_blocks(dst, indices);
+                dst += 10;
+                continue;
+            }
+            num_pending += base32_compact(pending + num_pending, indices, ignored);
+            if (num_pending >= 16) {
+                decode_blocks(dst, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pending)));
+                dst += 10;
+                num_pending -= 16;
+                memmove(pending, pending + 16, num_pending);
+            }
+        }
+        src = base32_unconsume<CodecVariant>(src, num_pending);
+        return static_cast<size_t>(src - src_begin);
+    }
+
+    // Checks 16 symbols per iteration like decode(), without decoding them. Unlike decode(),
+    // this stops at ignored characters too, so that it only ever consumes whole blocks.
+    static CPPCODEC_TARGET_SSE41 size_t scan(const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+        const __m128i symbol_bits = _mm_load_si128(reinterpret_cast<const __m128i*>(
+                base32_symbol_table<CodecVariant>::instance().symbol_bits));
+
+        for (; src_end - src >= 16; src += 16) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            if (_mm_movemask_epi8(is_not_symbol(in, symbol_bits))) {
+                break;
+            }
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+private:
+    // Looks up each character's bit in the row of its lower nibble, non-ASCII characters
+    // have no bit at all.
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i is_not_symbol(__m128i in, __m128i symbol_bits)
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        const __m128i hi_bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i row = _mm_shuffle_epi8(symbol_bits, _mm_and_si128(in, nibble));
+        const __m128i bit = _mm_shuffle_epi8(hi_bits, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+        return _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i indices_for(
+            __m128i in, const __m128i (&rows)[6])
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        const __m128i lo = _mm_and_si128(in, nibble);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+
+        __m128i indices = _mm_set1_epi8(static_cast<char>(base32_symbol_table<CodecVariant>::special));
+        for (size_t i = 0; i < 6; ++i) {
+            indices = _mm_blendv_epi8(indices, _mm_shuffle_epi8(rows[i], lo),
+                    _mm_cmpeq_epi8(hi, _mm_set1_epi8(static_cast<char>(i + 2))));
+        }
+        return indices;
+    }
+
+    // Decodes two blocks of 8 indices into 5 bytes each.
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 void decode_blocks(uint8_t* dst, __m128i indices)
+    {
+        const __m128i merged10 = _mm_maddubs_epi16(indices, _mm_set1_epi16(0x0120));
+        const __m128i merged20 = _mm_madd_epi16(merged10, _mm_set1_epi32(0x00010400));
+        const __m128i merged40 = _mm_add_epi64(
+                _mm_mul_epu32(merged20, _mm_set1_epi64x(1 << 20)), _mm_srli_epi64(merged20, 32));
+
+        const __m128i out = _mm_shuffle_epi8(merged40, _mm_setr_epi8(
+                4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), out);
+        uint16_t last = static_cast<uint16_t>(_mm_extract_epi16(out, 4));
+        memcpy(dst + 8, &last, 2);
+    }
+
+    // Look up each half of the alphabet with a byte shuffle and pick the right one.
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i symbols(__m128i indices)
+    {
+        const __m128i first_half = _mm_shuffle_epi8(alphabet(0), indices);
+        const __m128i second_half = _mm_shuffle_epi8(alphabet(16), indices);
+        return _mm_blendv_epi8(first_half, second_half, _mm_cmpgt_epi8(indices, _mm_set1_epi8(15)));
+    }
+};
+
+template <typename CodecVariant>
+class base32_avx2
+{
+public:
+    // Encodes four 5-byte blocks into 32 symbols per iteration.
+    static CPPCODEC_TARGET_AVX2 size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+
+        // Each 128-bit lane holds one block, with one 16-bit word for each of its 8 symbols.
+        // Each word contains the two bytes that the symbol's 5 bits are taken from,
+        // in big-endian order so that shifting it right by a per-symbol amount (via
+        // multiplication) gets the bits into place. The last symbol only needs a single byte.
+        // Blocks 0 and 2 come from lane offsets 0 and 6, blocks 1 and 3 from 5 and 11.
+        const __m256i spread_even = _mm256_setr_epi8(
+                1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 4, 4,
+                7, 6, 7, 6, 8, 7, 8, 7, 9, 8, 10, 9, 10, 9, 10, 10);
+        const __m256i spread_odd = _mm256_setr_epi8(
+                6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 9, 9,
+                12, 11, 12, 11, 13, 12, 13, 12, 14, 13, 15, 14, 15, 14, 15, 15);
+        // Multiplying by 2^(16 - n) and keeping the upper 16 bits amounts to a right shift by n.
+        const __m256i shifts = _mm256_setr_epi16(
+                1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8,
+                1 << 5, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8);
+        const __m256i mask = _mm256_set1_epi16(0x1F);
+
+        for (; src_end - src >= 20; src += 20, dst += 32) {
+            // Lane 0 gets bytes 0-15 (blocks 0 and 1), lane 1 bytes 4-19 (blocks 2 and 3).
+            const __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4)), 1);
+
+            const __m256i even = _mm256_and_si256(_mm256_mulhi_epu16(
+                    _mm256_shuffle_epi8(in, spread_even), shifts), mask);
+            const __m256i odd = _mm256_and_si256(_mm256_mulhi_epu16(
+                    _mm256_shuffle_epi8(in, spread_odd), shifts), mask);
+
+            // Packing interleaves lanes as [even.lane0, odd.lane0, even.lane1, odd.lane1],
+            // which is exactly the block order 0, 1, 2, 3.
+            const __m256i indices = _mm256_packus_epi16(even, odd);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), symbols(indices));
+        }
+        size_t num_bytes = static_cast<size_t>(src - src_begin);
+        return num_bytes + base32_sse41<CodecVariant>::encode(dst, src, src_size - num_bytes);
+    }
+
+    // Decodes 32 symbols into 20 bytes per iteration, dropping ignored characters
+    // (e.g. Crockford's hyphens) on the way. Stops at the first vector that contains
+    // anything else than alphabet symbols or ignored characters, without consuming it.
+    static CPPCODEC_TARGET_AVX2 size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        using symbol_table = base32_symbol_table<CodecVariant>;
+        const uint8_t* table = symbol_table::instance().index;
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        // All alphabets are made of printable ASCII characters (0x20-0x7F), so only
+        // those need lookup rows. Control and non-ASCII characters are left as special.
+        __m256i rows[6];
+        for (size_t i = 0; i < 6; ++i) {
+            rows[i] = _mm256_broadcastsi128_si256(
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(table + 16 * (i + 2))));
+        }
+
+        // Symbols left over after dropping ignored characters, waiting to make up whole vectors.
+        uint8_t pending[32 + 32 + 8];
+        size_t num_pending = 0;
+        bool stopped = false;
+
+        for (; src_end - src >= 32; src += 32) {
+            const __m256i indices = indices_for(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), rows);
+            if (_mm256_movemask_epi8(indices)) {
+                stopped = true; // padding, invalid symbol or similar, leave it to the scalar decoder
+                break;
+            }
+            uint32_t ignored = static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(indices, _mm256_set1_epi8(symbol_table::ignored))));
+
+            if (!ignored && !num_pending) {
+                decode_blocks(dst, indices);
+                dst += 20;
+                continue;
+            }
+            size_t num_kept = base32_compact(pending + num_pending,
+                    _mm256_castsi256_si128(indices), ignored & 0xFFFF);
+            num_kept += base32_compact(pending + num_pending + num_kept,
+                    _mm256_extracti128_si256(indices, 1), ignored >> 16);
+            num_pending += num_kept;
+            if (num_pending >= 32) {
+                decode_blocks(dst, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pending)));
+                dst += 20;
+                num_pending -= 32;
+                memmove(pending, pending + 32, num_pending);
+            }
+        }
+        src = base32_unconsume<CodecVariant>(src, num_pending);
+
+        size_t num_consumed = static_cast<size_t>(src - src_begin);
+        if (stopped) {
+            return num_consumed;
+        }
+        return num_consumed + base32_sse41<CodecVariant>::decode(dst, src, src_size - num_consumed);
+    }
+
+    // Checks 64 symbols per iteration like decode(), without decoding them.
+    // Stops at ignored characters too, see base32_sse41::scan().
+    static CPPCODEC_TARGET_AVX2 size_t scan(const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+        const __m256i symbol_bits = _mm256_broadcastsi128_si256(_mm_load_si128(
+                reinterpret_cast<const __m128i*>(base32_symbol_table<CodecVariant>::instance().symbol_bits)));
+
+        for (; src_end - src >= 64; src += 64) {
+            const __m256i in0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            const __m256i in1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+            if (_mm256_movemask_epi8(_mm256_or_si256(
+                    is_not_symbol(in0, symbol_bits), is_not_symbol(in1, symbol_bits)))) {
+                break;
+            }
+        }
+        size_t num_symbols = static_cast<size_t>(src - src_begin);
+        return num_symbols + base32_sse41<CodecVariant>::scan(src, src_size - num_symbols);
+    }
+
+private:
+    // See base32_sse41::is_not_symbol().
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i is_not_symbol(__m256i in, __m256i symbol_bits)
+    {
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+        const __m256i hi_bits = _mm256_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i row = _mm256_shuffle_epi8(symbol_bits, _mm256_and_si256(in, nibble));
+        const __m256i bit = _mm256_shuffle_epi8(hi_bits, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+        return _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), _mm256_setzero_si256());
+    }
+
+    // Lanes with characters that are not in the alphabet get the high bit set, ignored ones
+    // are marked with base32_symbol_table::ignored.
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i indices_for(
+            __m256i in, const __m256i (&rows)[6])
+    {
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+        const __m256i lo = _mm256_and_si256(in, nibble);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble);
+
+        __m256i indices = _mm256_set1_epi8(static_cast<char>(base32_symbol_table<CodecVariant>::special));
+        for (size_t i = 0; i < 6; ++i) {
+            indices = _mm256_blendv_epi8(indices, _mm256_shuffle_epi8(rows[i], lo),
+                    _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(static_cast<char>(i + 2))));
+        }
+        return indices;
+    }
+
+    // Decodes four blocks of 8 indices into 5 bytes each.
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 void decode_blocks(uint8_t* dst, __m256i indices)
+    {
+        // Merge pairs of 5-bit indices into 10 bits, then pairs of those into 20 bits,
+        // and finally both 20-bit halves of each block into a 40-bit quadword.
+        const __m256i merged10 = _mm256_maddubs_epi16(indices, _mm256_set1_epi16(0x0120));
+        const __m256i merged20 = _mm256_madd_epi16(merged10, _mm256_set1_epi32(0x00010400));
+        const __m256i merged40 = _mm256_add_epi64(
+                _mm256_mul_epu32(merged20, _mm256_set1_epi64x(1 << 20)),
+                _mm256_srli_epi64(merged20, 32));
+
+        // Each lane now holds two blocks, gather their bytes in big-endian order.
+        const __m256i out = _mm256_shuffle_epi8(merged40, _mm256_setr_epi8(
+                4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+                4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+        const __m128i hi = _mm256_extracti128_si256(out, 1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(out));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 10), hi);
+        uint16_t last = static_cast<uint16_t>(_mm_extract_epi16(hi, 4));
+        memcpy(dst + 18, &last, 2);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i symbols(__m256i indices)
+    {
+        const __m256i first_half = _mm256_shuffle_epi8(
+                _mm256_broadcastsi128_si256(base32_sse41<CodecVariant>::alphabet(0)), indices);
+        const __m256i second_half = _mm256_shuffle_epi8(
+                _mm256_broadcastsi128_si256(base32_sse41<CodecVariant>::alphabet(16)), indices);
+        return _mm256_blendv_epi8(first_half, second_half,
+                _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(15)));
+    }
+};
+
+#endif // CPPCODEC_X86_SIMD
+
+template <typename CodecVariant>
+struct simd_kernels<base32<CodecVariant>>
+#if CPPCODEC_X86_SIMD
+        : simd_tiered_kernels<base32_avx2<CodecVariant>, base32_sse41<CodecVariant>,
+                base32_swar<CodecVariant>>
+#else
+        : scalar_kernels<base32_swar<CodecVariant>>
+#endif
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_encoder() { return CodecVariant::alphabet_size() == 32; }
+
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_decoder()
+    {
+#if CPPCODEC_X86_SIMD
+        return CodecVariant::alphabet_size() == 32;
+#else
+        return false;
+#endif
+    }
+};
+
+} // namespace detail
+} // namespace cppcodec
+
+#endif // CPPCODEC_DETAIL_BASE32_SIMD
@@ -34,6 +34,7 @@
 
 #include "../data/access.hpp"
 #include "../parse_error.hpp"
+#include "base64_simd.hpp"
 #include "config.hpp"
 #include "stream_codec.hpp"
 
@@ -85,6 +86,14 @@ public:
         throw std::domain_error("invalid last encoding symbol index in a tail");
     }
 
+    // Error message if a last block can't have idx_len symbols, nullptr if decode_tail() accepts it.
+    static CPPCODEC_ALWAYS_INLINE constexpr const char* invalid_tail_size(size_t idx_len) noexcept
+    {
+        return (idx_len == 1)
+                ? "invalid number of symbols in last base64 block: found 1, expected 2 or 3"
+                : nullptr;
+    }
+
     template <typename Result, typename ResultState>
     static CPPCODEC_ALWAYS_INLINE void decode_block(
             Result& decoded, ResultState&, const alphabet_index_t* idx);
@@ -111,10 +120,7 @@ template <typename Result, typename ResultState>
 CPPCODEC_ALWAYS_INLINE void base64<CodecVariant>::decode_tail(
         Result& decoded, ResultState& state, const alphabet_index_t* idx, size_t idx_len)
 {
-    if (idx_len == 1) {
-        throw invalid_input_length(
-                "invalid number of symbols in last base64 block: found 1, expected 2 or 3");
-    }
+    // idx_len == 1 has been rejected by invalid_tail_size().
 
     // idx_len == 2: decoded size 1
     data::put(decoded, state, static_cast<uint8_t>((idx[0] << 2) + ((idx[1] & 0x30) >> 4)));
@@ -0,0 +1,502 @@
+/**
+ *  Copyright (C) 2026 agent
+ *  All rights reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Vector algorithms adapted from Wojciech Muła's "base64 encoding with SIMD
+ *  instructions", http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html,
+ *  and "base64 decoding with SIMD instructions",
+ *  http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html.
+ */
+
+#ifndef CPPCODEC_DETAIL_BASE64_SIMD
+#define CPPCODEC_DETAIL_BASE64_SIMD
+
+#include <stdint.h>
+#include <string.h> // for memcpy()
+#include <type_traits>
+
+#include "config.hpp"
+#include "stream_codec.hpp"
+#include "swar.hpp"
+
+#if CPPCODEC_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace cppcodec {
+namespace detail {
+
+template <typename CodecVariant> class base64;
+
+// The vector kernels compute symbols arithmetically from their index instead of
+// doing a table lookup. That works for any alphabet that starts out as A-Z, a-z, 0-9
+// (which all of the RFC 4648 ones do) and only differs in the last two symbols.
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr bool base64_symbols_in_sequence(
+        alphabet_index_t idx, char first, size_t count)
+{
+    return count == 0 || (CodecVariant::symbol(idx) == first
+            && base64_symbols_in_sequence<CodecVariant>(
+                    static_cast<alphabet_index_t>(idx + 1), static_cast<char>(first + 1), count - 1));
+}
+
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr bool base64_has_standard_alphabet()
+{
+    return CodecVariant::alphabet_size() == 64
+            && base64_symbols_in_sequence<CodecVariant>(0, 'A', 26)
+            && base64_symbols_in_sequence<CodecVariant>(26, 'a', 26)
+            && base64_symbols_in_sequence<CodecVariant>(52, '0', 10);
+}
+
+// Difference between a symbol and its index, for each range of consecutive symbols.
+CPPCODEC_ALWAYS_INLINE constexpr char base64_symbol_offset(alphabet_index_t idx, char first_symbol)
+{
+    return static_cast<char>(first_symbol - static_cast<char>(idx));
+}
+
+// Scalar tier, works with any alphabet.
+template <typename CodecVariant>
+class base64_swar
+{
+public:
+    // Encodes 6 bytes into 8 symbols per iteration, with one 64-bit load and store each.
+    static inline size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+
+        // Each iteration loads 8 bytes, but only encodes 6 of them.
+        for (; src_end - src >= 8; src += 6, dst += 8) {
+            swar_store_le64(dst, swar_symbols<CodecVariant, 6>(swar_load_be64(src)));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+};
+
+// Two symbols for each 12-bit index, with the first one in the low byte.
+struct base64_pair_row {
+    uint16_t pairs[64];
+};
+
+struct base64_pair_table {
+    base64_pair_row rows[64]; // indexed by the first symbol's 6 bits
+};
+
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr uint16_t base64_symbol_pair(unsigned first, unsigned second)
+{
+    return static_cast<uint16_t>(static_cast<uint8_t>(CodecVariant::symbol(static_cast<alphabet_index_t>(first)))
+            | (static_cast<uint8_t>(CodecVariant::symbol(static_cast<alphabet_index_t>(second))) << 8));
+}
+
+template <typename CodecVariant, unsigned... Is>
+constexpr base64_pair_row make_base64_pair_row(unsigned first, seq<Is...>)
+{
+    return { { base64_symbol_pair<CodecVariant>(first, Is)... } };
+}
+
+// Built one row at a time, gen_seq<4096> would exceed the default template recursion limits.
+template <typename CodecVariant, unsigned... Is>
+constexpr base64_pair_table make_base64_pair_table(seq<Is...>)
+{
+    return { { make_base64_pair_row<CodecVariant>(Is, gen_seq<64>())... } };
+}
+
+// Table-driven scalar tier, replaces base64_swar if CPPCODEC_ENCODE_PAIR_TABLES is defined.
+// Trades an 8 KiB table per alphabet for half the number of lookups, which helps when
+// the vectorized tiers aren't available or allowed.
+template <typename CodecVariant>
+class base64_pair_table_encoder
+{
+public:
+    // Encodes 6 bytes into 8 symbols per iteration, with four lookups of 12 bits each.
+    static inline size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        static constexpr const base64_pair_table t = make_base64_pair_table<CodecVariant>(gen_seq<64>());
+
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+
+        // Each iteration loads 8 bytes, but only encodes 6 of them.
+        for (; src_end - src >= 8; src += 6, dst += 8) {
+            const uint64_t word = swar_load_be64(src);
+            swar_store_le64(dst, pair_at(t, word >> 52)
+                    | (pair_at(t, word >> 40) << 16)
+                    | (pair_at(t, word >> 28) << 32)
+                    | (pair_at(t, word >> 16) << 48));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+private:
+    static CPPCODEC_ALWAYS_INLINE uint64_t pair_at(const base64_pair_table& t, uint64_t idx)
+    {
+        return t.rows[(idx >> 6) & 0x3F].pairs[idx & 0x3F];
+    }
+};
+
+#if defined(CPPCODEC_ENCODE_PAIR_TABLES)
+template <typename CodecVariant> using base64_scalar_encoder = base64_pair_table_encoder<CodecVariant>;
+#else
+template <typename CodecVariant> using base64_scalar_encoder = base64_swar<CodecVariant>;
+#endif
+
+#if CPPCODEC_X86_SIMD
+
+template <typename CodecVariant>
+class base64_sse41
+{
+public:
+    // Encodes 12 bytes into 16 symbols per iteration, see base64_avx2::encode().
+    static CPPCODEC_TARGET_SSE41 size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+        const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+        // Each iteration loads 16 bytes, but only encodes 12 of them.
+        for (; src_end - src >= 16; src += 12, dst += 16) {
+            const __m128i in = _mm_shuffle_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), spread);
+
+            const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+            const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+            const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+            const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+            const __m128i indices = _mm_or_si128(t1, t3);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), symbols(indices));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+    // Decodes 16 symbols into 12 bytes per iteration, see base64_avx2::decode().
+    static CPPCODEC_TARGET_SSE41 size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+        const __m128i gather_bytes = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        for (; src_end - src >= 16; src += 16, dst += 12) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+            __m128i valid;
+            const __m128i indices = indices_for(in, valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF) {
+                break;
+            }
+
+            const __m128i merged12 = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140));
+            const __m128i merged24 = _mm_madd_epi16(merged12, _mm_set1_epi32(0x00011000));
+            const __m128i out = _mm_shuffle_epi8(merged24, gather_bytes);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), out);
+            uint32_t last = static_cast<uint32_t>(_mm_extract_epi32(out, 2));
+            memcpy(dst + 8, &last, 4);
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+    // Checks 16 symbols per iteration like decode(), without decoding them.
+    static CPPCODEC_TARGET_SSE41 size_t scan(const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        for (; src_end - src >= 16; src += 16) {
+            __m128i valid;
+            indices_for(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF) {
+                break;
+            }
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+private:
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i in_range(__m128i in, char first, char last)
+    {
+        return _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8(static_cast<char>(first - 1))),
+                _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(last + 1)), in));
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i indices_for(__m128i in, __m128i& valid)
+    {
+        const __m128i is_upper = in_range(in, 'A', 'Z');
+        const __m128i is_lower = in_range(in, 'a', 'z');
+        const __m128i is_digit = in_range(in, '0', '9');
+        const __m128i is_sym62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(CodecVariant::symbol(62)));
+        const __m128i is_sym63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(CodecVariant::symbol(63)));
+
+        valid = _mm_or_si128(_mm_or_si128(is_upper, is_lower),
+                _mm_or_si128(is_digit, _mm_or_si128(is_sym62, is_sym63)));
+
+        __m128i offsets = _mm_and_si128(is_upper, _mm_set1_epi8(base64_symbol_offset(0, 'A')));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(is_lower, _mm_set1_epi8(base64_symbol_offset(26, 'a'))));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(is_digit, _mm_set1_epi8(base64_symbol_offset(52, '0'))));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(is_sym62,
+                _mm_set1_epi8(base64_symbol_offset(62, CodecVariant::symbol(62)))));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(is_sym63,
+                _mm_set1_epi8(base64_symbol_offset(63, CodecVariant::symbol(63)))));
+        return _mm_sub_epi8(in, offsets);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i symbols(__m128i indices)
+    {
+        const char lower = base64_symbol_offset(26, 'a');
+        const char digit = base64_symbol_offset(52, '0');
+        const char upper = base64_symbol_offset(0, 'A');
+        const __m128i offsets = _mm_setr_epi8(
+                lower, digit, digit, digit, digit, digit, digit, digit,
+                digit, digit, digit, base64_symbol_offset(62, CodecVariant::symbol(62)),
+                base64_symbol_offset(63, CodecVariant::symbol(63)), upper, 0, 0);
+
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        range = _mm_or_si128(range, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+        return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+    }
+};
+
+template <typename CodecVariant>
+class base64_avx2
+{
+public:
+    // Encodes 24 bytes into 32 symbols per iteration.
+    static CPPCODEC_TARGET_AVX2 size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        if (src_size < 28) {
+            return base64_sse41<CodecVariant>::encode(dst, src, src_size);
+        }
+        // Each iteration loads 16 bytes at both src and src + 12, but only encodes 24 of them.
+        const uint8_t* const src_last = src + (src_size - 28);
+
+        // Within each 128-bit lane, spread three bytes [a, b, c] over four as [b, a, c, b]
+        // so that each 6-bit index can be shifted into place with a 16-bit multiplication.
+        const __m256i spread = _mm256_setr_epi8(
+                1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+        for (; src <= src_last; src += 24, dst += 32) {
+            __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12)), 1);
+            in = _mm256_shuffle_epi8(in, spread);
+
+            const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            const __m256i indices = _mm256_or_si256(t1, t3);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), symbols(indices));
+        }
+        size_t num_bytes = static_cast<size_t>(src - src_begin);
+        return num_bytes + base64_sse41<CodecVariant>::encode(dst, src, src_size - num_bytes);
+    }
+
+    // Decodes 32 symbols into 24 bytes per iteration. Stops at the first vector that
+    // contains anything else than alphabet symbols, without consuming it.
+    static CPPCODEC_TARGET_AVX2 size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        // Gather the 24 bytes of each 32-bit lane's three leading bytes (in big-endian order)
+        // in the lower 192 bits of the vector.
+        const __m256i gather_bytes = _mm256_setr_epi8(
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        const __m256i gather_lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+        for (; src_end - src >= 32; src += 32, dst += 24) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+
+            __m256i valid;
+            const __m256i indices = indices_for(in, valid);
+            if (_mm256_movemask_epi8(valid) != -1) {
+                break;
+            }
+
+            // Merge pairs of 6-bit indices into 12 bits each, then pairs of those into 24 bits.
+            const __m256i merged12 = _mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x01400140));
+            const __m256i merged24 = _mm256_madd_epi16(merged12, _mm256_set1_epi32(0x00011000));
+            const __m256i out = _mm256_permutevar8x32_epi32(
+                    _mm256_shuffle_epi8(merged24, gather_bytes), gather_lanes);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(out));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16), _mm256_extracti128_si256(out, 1));
+        }
+        if (src_end - src >= 32) {
+            return static_cast<size_t>(src - src_begin); // stopped early, leave the rest to the scalar decoder
+        }
+        size_t num_symbols = static_cast<size_t>(src - src_begin);
+        return num_symbols + base64_sse41<CodecVariant>::decode(dst, src, src_size - num_symbols);
+    }
+
+    // Checks 64 symbols per iteration like decode(), without decoding them.
+    // The SSE4.1 kernel narrows down where the first non-alphabet character is.
+    static CPPCODEC_TARGET_AVX2 size_t scan(const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        for (; src_end - src >= 64; src += 64) {
+            __m256i valid0, valid1;
+            indices_for(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), valid0);
+            indices_for(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32)), valid1);
+            if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1) {
+                break;
+            }
+        }
+        size_t num_symbols = static_cast<size_t>(src - src_begin);
+        return num_symbols + base64_sse41<CodecVariant>::scan(src, src_size - num_symbols);
+    }
+
+private:
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i in_range(__m256i in, char first, char last)
+    {
+        // Symbols are ASCII, so signed comparison is fine and rejects all bytes >= 0x80.
+        return _mm256_and_si256(
+                _mm256_cmpgt_epi8(in, _mm256_set1_epi8(static_cast<char>(first - 1))),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), in));
+    }
+
+    // Inverse of symbols(): classify each symbol by range and subtract the range's offset.
+    // Lanes that are not part of the alphabet have their bits in valid set to zero.
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i indices_for(__m256i in, __m256i& valid)
+    {
+        const __m256i is_upper = in_range(in, 'A', 'Z');
+        const __m256i is_lower = in_range(in, 'a', 'z');
+        const __m256i is_digit = in_range(in, '0', '9');
+        const __m256i is_sym62 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(CodecVariant::symbol(62)));
+        const __m256i is_sym63 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(CodecVariant::symbol(63)));
+
+        valid = _mm256_or_si256(_mm256_or_si256(is_upper, is_lower),
+                _mm256_or_si256(is_digit, _mm256_or_si256(is_sym62, is_sym63)));
+
+        __m256i offsets = _mm256_and_si256(is_upper, _mm256_set1_epi8(base64_symbol_offset(0, 'A')));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_lower,
+                _mm256_set1_epi8(base64_symbol_offset(26, 'a'))));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_digit,
+                _mm256_set1_epi8(base64_symbol_offset(52, '0'))));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_sym62,
+                _mm256_set1_epi8(base64_symbol_offset(62, CodecVariant::symbol(62)))));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_sym63,
+                _mm256_set1_epi8(base64_symbol_offset(63, CodecVariant::symbol(63)))));
+        return _mm256_sub_epi8(in, offsets);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i symbols(__m256i indices)
+    {
+        // Reduce each index to a range number: 0 for a-z, 1-10 for 0-9, 11 and 12 for
+        // the two alphabet-specific symbols and 13 for A-Z. Then add the range's offset.
+        const char lower = base64_symbol_offset(26, 'a');
+        const char digit = base64_symbol_offset(52, '0');
+        const char upper = base64_symbol_offset(0, 'A');
+        const char sym62 = base64_symbol_offset(62, CodecVariant::symbol(62));
+        const char sym63 = base64_symbol_offset(63, CodecVariant::symbol(63));
+        const __m256i offsets = _mm256_setr_epi8(
+                lower, digit, digit, digit, digit, digit, digit, digit,
+                digit, digit, digit, sym62, sym63, upper, 0, 0,
+                lower, digit, digit, digit, digit, digit, digit, digit,
+                digit, digit, digit, sym62, sym63, upper, 0, 0);
+
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        range = _mm256_or_si256(range, _mm256_and_si256(is_upper, _mm256_set1_epi8(13)));
+        return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+    }
+};
+
+#endif // CPPCODEC_X86_SIMD
+
+template <typename CodecVariant>
+struct simd_kernels<base64<CodecVariant>>
+#if CPPCODEC_X86_SIMD
+        : std::conditional<base64_has_standard_alphabet<CodecVariant>(),
+                simd_tiered_kernels<base64_avx2<CodecVariant>, base64_sse41<CodecVariant>,
+                        base64_scalar_encoder<CodecVariant>>,
+                scalar_kernels<base64_scalar_encoder<CodecVariant>>>::type
+#else
+        : scalar_kernels<base64_scalar_encoder<CodecVariant>>
+#endif
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_encoder() { return true; }
+
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_decoder()
+    {
+#if CPPCODEC_X86_SIMD
+        return base64_has_standard_alphabet<CodecVariant>();
+#else
+        return false;
+#endif
+    }
+};
+
+#if defined(CPPCODEC_DECODE_PAIR_TABLES)
+
+// The 12 bits that two symbols decode to, or 0x8000 if either one is a stop character.
+template <typename CodecVariant>
+struct base64_pair_value
+{
+    using index_info = alphabet_index_info<CodecVariant>;
+
+    static CPPCODEC_ALWAYS_INLINE constexpr uint16_t for_indexes(alphabet_index_t first, alphabet_index_t second)
+    {
+        return ((first | second) & index_info::stop_character_mask)
+                ? 0x8000 : static_cast<uint16_t>((first << 6) | second);
+    }
+};
+
+template <typename CodecVariant>
+struct pair_decoder<base64<CodecVariant>>
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool enabled() { return true; }
+
+    template <typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE bool decode_block(Result& decoded, ResultState& state, const char* src)
+    {
+        static constexpr const pair_lookup_table t =
+                make_pair_lookup_table<base64_pair_value<CodecVariant>>(
+                        alphabet_index_info<CodecVariant>::index_table(), gen_seq<256>());
+
+        const uint32_t first = t.rows[static_cast<uint8_t>(src[0])].values[static_cast<uint8_t>(src[1])];
+        const uint32_t second = t.rows[static_cast<uint8_t>(src[2])].values[static_cast<uint8_t>(src[3])];
+        if ((first | second) & 0x8000) {
+            return false;
+        }
+        const uint32_t bits = (first << 12) | second;
+        data::put(decoded, state, static_cast<uint8_t>(bits >> 16));
+        data::put(decoded, state, static_cast<uint8_t>(bits >> 8));
+        data::put(decoded, state, static_cast<uint8_t>(bits));
+        return true;
+    }
+};
+
+#endif // CPPCODEC_DECODE_PAIR_TABLES
+
+} // namespace detail
+} // namespace cppcodec
+
+#endif // CPPCODEC_DETAIL_BASE64_SIMD
@@ -26,11 +26,17 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <stdlib.h> // for abort()
+#include <string.h> // for memcpy()
+#include <array>
+#include <limits>
 #include <string>
 #include <vector>
 
 #include "../data/access.hpp"
 #include "../data/raw_result_buffer.hpp"
+#include "../parse_error.hpp"
+#include "../simd.hpp"
 
 namespace cppcodec {
 namespace detail {
@@ -39,6 +45,11 @@ namespace detail {
 template <typename T>
 struct non_numeric : std::enable_if<!std::is_arithmetic<T>::value> { };
 
+// Keeps a template parameter from being deduced from an argument, so that it has to be
+// specified explicitly and overloads with deduced parameters keep working as before.
+template <typename T>
+struct non_deduced { using type = T; };
+
 
 /**
  * Public interface for all the codecs. For API documentation, see README.md.
@@ -69,6 +80,22 @@ public:
     template <typename Result, typename T, typename non_numeric<T>::type* = nullptr>
     static void encode(Result& encoded_result, const T& binary);
 
+    // Append to a reused result container, keeping its previous contents.
+    template <typename Result>
+    static void encode_append(Result& encoded_result, const uint8_t* binary, size_t binary_size);
+    template <typename Result>
+    static void encode_append(Result& encoded_result, const char* binary, size_t binary_size);
+    template <typename Result, typename T, typename non_numeric<T>::type* = nullptr>
+    static void encode_append(Result& encoded_result, const T& binary);
+
+    // Encode many inputs back to back into one result, resizing both result and offsets.
+    // The encoding of input i is at [offsets[i], offsets[i + 1]) in encoded_result.
+    template <typename Result, typename Offsets, typename Binaries>
+    static void encode_batch(Result& encoded_result, Offsets& offsets, const Binaries& binaries);
+    template <typename Result, typename Offsets>
+    static void encode_batch(Result& encoded_result, Offsets& offsets,
+            const uint8_t* const* binaries, const size_t* binary_sizes, size_t num_binaries);
+
     // Raw pointer output, assumes pre-allocated memory with size > encoded_size(binary_size).
     static size_t encode(
             char* encoded_result, size_t encoded_buffer_size,
@@ -81,9 +108,21 @@ public:
             char* encoded_result, size_t encoded_buffer_size,
             const T& binary) noexcept;
 
+    // Fixed-size version for binary data of a size known at compile time, e.g. encode<16>(uuid).
+    template <size_t N>
+    static std::array<char, CodecImpl::encoded_size(N)> encode(
+            const typename non_deduced<uint8_t[N]>::type& binary) noexcept;
+    template <size_t N>
+    static std::array<char, CodecImpl::encoded_size(N)> encode(
+            const typename non_deduced<std::array<uint8_t, N>>::type& binary) noexcept;
+
     // Calculate the exact length of the encoded string based on binary size.
     static constexpr size_t encoded_size(size_t binary_size) noexcept;
 
+    // Incremental version for input that arrives in several pieces. Appends to the result
+    // and carries bytes that don't make up a whole block over to the next call.
+    class encoder;
+
     //
     // Decoding
 
@@ -102,7 +141,21 @@ public:
     template <typename Result, typename T, typename non_numeric<T>::type* = nullptr>
     static void decode(Result& binary_result, const T& encoded);
 
-    // Raw pointer output, assumes pre-allocated memory with size > decoded_max_size(encoded_size).
+    // Append to a reused result container, keeping its previous contents.
+    template <typename Result>
+    static void decode_append(Result& binary_result, const char* encoded, size_t encoded_size);
+    template <typename Result, typename T, typename non_numeric<T>::type* = nullptr>
+    static void decode_append(Result& binary_result, const T& encoded);
+
+    // Fixed-size version for binary data of a size known at compile time, e.g. decode<16>(uuid).
+    // Throws invalid_input_length if the input doesn't decode to exactly N bytes.
+    template <size_t N>
+    static std::array<uint8_t, N> decode(const char* encoded, size_t encoded_size);
+    template <size_t N, typename T>
+    static std::array<uint8_t, N> decode(const T& encoded);
+
+    // Raw pointer output, assumes pre-allocated memory with size >= decoded_size(encoded, encoded_size),
+    // e.g. decoded_max_size(encoded_size).
     static size_t decode(
             uint8_t* binary_result, size_t binary_buffer_size,
             const char* encoded, size_t encoded_size);
@@ -114,8 +167,115 @@ public:
     template<typename T> static size_t decode(
             char* binary_result, size_t binary_buffer_size, const T& encoded);
 
+    // Non-throwing versions of the above, returning the error kind and position instead.
+    // Bytes decoded before an error are left in the result.
+    template <typename Result>
+    static decode_result try_decode(
+            Result& binary_result, const char* encoded, size_t encoded_size) noexcept;
+    template <typename Result, typename T, typename non_numeric<T>::type* = nullptr>
+    static decode_result try_decode(Result& binary_result, const T& encoded) noexcept;
+    static decode_result try_decode(
+            uint8_t* binary_result, size_t binary_buffer_size,
+            const char* encoded, size_t encoded_size) noexcept;
+    static decode_result try_decode(
+            char* binary_result, size_t binary_buffer_size,
+            const char* encoded, size_t encoded_size) noexcept;
+    template<typename T> static decode_result try_decode(
+            uint8_t* binary_result, size_t binary_buffer_size, const T& encoded) noexcept;
+    template<typename T> static decode_result try_decode(
+            char* binary_result, size_t binary_buffer_size, const T& encoded) noexcept;
+
+    // Decode many inputs back to back into one result without throwing on invalid input.
+    // The decoded bytes of input i are at [offsets[i], offsets[i + 1]) in binary_result,
+    // results[i] reports errors like try_decode() and invalid inputs don't keep any bytes.
+    // Returns the number of invalid inputs.
+    template <typename Result, typename Offsets, typename Results, typename Encodeds>
+    static size_t decode_batch(Result& binary_result, Offsets& offsets, Results& results,
+            const Encodeds& encodeds);
+    template <typename Result, typename Offsets, typename Results>
+    static size_t decode_batch(Result& binary_result, Offsets& offsets, Results& results,
+            const char* const* encodeds, const size_t* encoded_sizes, size_t num_encodeds);
+
+    // Check the input like try_decode() without writing the decoded bytes anywhere.
+    // The size of the returned result is the number of bytes that decode() would write.
+    static decode_result validate(const char* encoded, size_t encoded_size) noexcept;
+    template <typename T> static decode_result validate(const T& encoded) noexcept;
+
     // Calculate the maximum size of the decoded binary buffer based on the encoded string length.
     static constexpr size_t decoded_max_size(size_t encoded_size) noexcept;
+
+    // Calculate the exact size of the decoded binary data, without padding and ignored characters.
+    // Only an upper bound if the encoded string is invalid.
+    static size_t decoded_size(const char* encoded, size_t encoded_size) noexcept;
+    template <typename T> static size_t decoded_size(const T& encoded) noexcept;
+
+    // Incremental version for input that arrives in several pieces. Appends to the result
+    // and carries symbols that don't make up a whole block over to the next call.
+    class decoder;
+
+    //
+    // Introspection
+
+    // Instruction set tier of the vectorized kernels currently used for encoding/decoding.
+    static simd_tier encoder_simd_tier() noexcept;
+    static simd_tier decoder_simd_tier() noexcept;
+
+private:
+    // Shared by both fixed-size encode() overloads.
+    template <size_t N>
+    static std::array<char, CodecImpl::encoded_size(N)> encode_fixed(const uint8_t* binary) noexcept;
+
+    // Aborts if offsets of OffsetType can't represent positions up to total_size.
+    template <typename OffsetType>
+    static void check_offset_range(size_t total_size) noexcept;
+
+    // Shared by both decode_batch() overloads, encoded(i) returns input i as (pointer, size).
+    template <typename Result, typename Offsets, typename Results, typename Encoded>
+    static size_t decode_batch_impl(Result& binary_result, Offsets& offsets, Results& results,
+            size_t num_encodeds, const Encoded& encoded);
+};
+
+
+template <typename CodecImpl>
+class codec<CodecImpl>::encoder
+{
+public:
+    template <typename Result>
+    void update(const uint8_t* binary, size_t binary_size, Result& encoded_result);
+    template <typename Result>
+    void update(const char* binary, size_t binary_size, Result& encoded_result);
+    template <typename T, typename Result, typename non_numeric<T>::type* = nullptr>
+    void update(const T& binary, Result& encoded_result);
+
+    // Encodes the remaining bytes including padding, after which the encoder can be reused.
+    template <typename Result>
+    void finish(Result& encoded_result);
+
+    // Number of bytes carried over to the next update() or finish().
+    size_t pending_size() const noexcept { return m_num_pending; }
+
+private:
+    uint8_t m_pending[CodecImpl::binary_block_size()];
+    size_t m_num_pending = 0;
+};
+
+template <typename CodecImpl>
+class codec<CodecImpl>::decoder
+{
+public:
+    template <typename Result>
+    void update(const char* encoded, size_t encoded_size, Result& binary_result);
+    template <typename T, typename Result, typename non_numeric<T>::type* = nullptr>
+    void update(const T& encoded, Result& binary_result);
+
+    // Decodes the remaining symbols and checks padding, after which the decoder can be reused.
+    template <typename Result>
+    void finish(Result& binary_result);
+
+private:
+    using decode_progress = typename CodecImpl::decode_progress;
+
+    decode_progress m_progress;
 };
 
 
@@ -191,6 +351,102 @@ inline void codec<CodecImpl>::encode(Result& encoded_result, const T& binary)
     encode(encoded_result, data::uchar_data(binary), data::size(binary));
 }
 
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::encode_append(
+    Result& encoded_result, const uint8_t* binary, size_t binary_size)
+{
+    size_t encoded_buffer_size = encoded_size(binary_size);
+    size_t previous_size = data::size(encoded_result);
+    auto state = data::create_state(encoded_result, data::specific_t());
+    data::init_append(encoded_result, state, encoded_buffer_size);
+
+    CodecImpl::encode(encoded_result, state, binary, binary_size);
+    data::finish(encoded_result, state);
+    assert(data::size(encoded_result) == previous_size + encoded_buffer_size);
+    (void)previous_size;
+}
+
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::encode_append(
+    Result& encoded_result, const char* binary, size_t binary_size)
+{
+    encode_append(encoded_result, reinterpret_cast<const uint8_t*>(binary), binary_size);
+}
+
+template <typename CodecImpl>
+template <typename Result, typename T, typename non_numeric<T>::type*>
+inline void codec<CodecImpl>::encode_append(Result& encoded_result, const T& binary)
+{
+    encode_append(encoded_result, data::uchar_data(binary), data::size(binary));
+}
+
+template <typename CodecImpl>
+template <typename Result, typename Offsets, typename Binaries>
+inline void codec<CodecImpl>::encode_batch(
+        Result& encoded_result, Offsets& offsets, const Binaries& binaries)
+{
+    // Offsets are known in advance, so the result only needs to be set up once for all inputs.
+    using offset_type = typename std::decay<decltype(offsets[0])>::type;
+    size_t encoded_buffer_size = 0;
+    for (const auto& binary : binaries) {
+        encoded_buffer_size += encoded_size(data::size(binary));
+    }
+    check_offset_range<offset_type>(encoded_buffer_size);
+    offsets.resize(binaries.size() + 1);
+
+    auto state = data::create_state(encoded_result, data::specific_t());
+    data::init(encoded_result, state, encoded_buffer_size);
+    size_t offset = 0;
+    size_t i = 0;
+    for (const auto& binary : binaries) {
+        offsets[i++] = static_cast<offset_type>(offset);
+        offset += encoded_size(data::size(binary));
+        CodecImpl::encode(encoded_result, state, data::uchar_data(binary), data::size(binary));
+    }
+    offsets[i] = static_cast<offset_type>(offset);
+    data::finish(encoded_result, state);
+    assert(data::size(encoded_result) == encoded_buffer_size);
+}
+
+template <typename CodecImpl>
+template <typename Result, typename Offsets>
+inline void codec<CodecImpl>::encode_batch(Result& encoded_result, Offsets& offsets,
+        const uint8_t* const* binaries, const size_t* binary_sizes, size_t num_binaries)
+{
+    using offset_type = typename std::decay<decltype(offsets[0])>::type;
+    size_t encoded_buffer_size = 0;
+    for (size_t i = 0; i < num_binaries; ++i) {
+        encoded_buffer_size += encoded_size(binary_sizes[i]);
+    }
+    check_offset_range<offset_type>(encoded_buffer_size);
+    offsets.resize(num_binaries + 1);
+
+    auto state = data::create_state(encoded_result, data::specific_t());
+    data::init(encoded_result, state, encoded_buffer_size);
+    size_t offset = 0;
+    for (size_t i = 0; i < num_binaries; ++i) {
+        offsets[i] = static_cast<offset_type>(offset);
+        offset += encoded_size(binary_sizes[i]);
+        CodecImpl::encode(encoded_result, state, binaries[i], binary_sizes[i]);
+    }
+    offsets[num_binaries] = static_cast<offset_type>(offset);
+    data::finish(encoded_result, state);
+    assert(data::size(encoded_result) == encoded_buffer_size);
+}
+
+template <typename CodecImpl>
+template <typename OffsetType>
+inline void codec<CodecImpl>::check_offset_range(size_t total_size) noexcept
+{
+    // Like raw_result_buffer with too little capacity, offsets that would be truncated
+    // are a programming error rather than invalid input.
+    if (static_cast<uintmax_t>(total_size) > static_cast<uintmax_t>(std::numeric_limits<OffsetType>::max())) {
+        abort();
+    }
+}
+
 template <typename CodecImpl>
 inline size_t codec<CodecImpl>::encode(
         char* encoded_result, size_t encoded_buffer_size,
@@ -226,12 +482,99 @@ inline size_t codec<CodecImpl>::encode(
     return encode(encoded_result, encoded_buffer_size, data::uchar_data(binary), data::size(binary));
 }
 
+template <typename CodecImpl>
+template <size_t N>
+inline std::array<char, CodecImpl::encoded_size(N)> codec<CodecImpl>::encode(
+        const typename non_deduced<uint8_t[N]>::type& binary) noexcept
+{
+    return encode_fixed<N>(binary);
+}
+
+template <typename CodecImpl>
+template <size_t N>
+inline std::array<char, CodecImpl::encoded_size(N)> codec<CodecImpl>::encode(
+        const typename non_deduced<std::array<uint8_t, N>>::type& binary) noexcept
+{
+    return encode_fixed<N>(binary.data());
+}
+
+template <typename CodecImpl>
+template <size_t N>
+inline std::array<char, CodecImpl::encoded_size(N)> codec<CodecImpl>::encode_fixed(
+        const uint8_t* binary) noexcept
+{
+    std::array<char, CodecImpl::encoded_size(N)> encoded_result;
+    data::raw_result_buffer encoded(encoded_result.data(), encoded_result.size());
+    encoded.resize(0);
+    data::empty_result_state state;
+    CodecImpl::template encode_fixed<N>(encoded, state, binary);
+    assert(data::size(encoded) == encoded_result.size());
+    return encoded_result;
+}
+
 template <typename CodecImpl>
 inline constexpr size_t codec<CodecImpl>::encoded_size(size_t binary_size) noexcept
 {
     return CodecImpl::encoded_size(binary_size);
 }
 
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::encoder::update(
+        const uint8_t* binary, size_t binary_size, Result& encoded_result)
+{
+    if (!binary_size) {
+        return;
+    }
+    if (m_num_pending) {
+        size_t num_taken = CodecImpl::binary_block_size() - m_num_pending;
+        if (num_taken > binary_size) {
+            num_taken = binary_size;
+        }
+        memcpy(m_pending + m_num_pending, binary, num_taken);
+        m_num_pending += num_taken;
+        binary += num_taken;
+        binary_size -= num_taken;
+
+        if (m_num_pending < CodecImpl::binary_block_size()) {
+            return;
+        }
+        codec::encode_append(encoded_result, m_pending, m_num_pending);
+        m_num_pending = 0;
+    }
+
+    // Whole blocks don't get any padding, so they encode the same as in one long input.
+    size_t num_whole = binary_size / CodecImpl::binary_block_size() * CodecImpl::binary_block_size();
+    if (num_whole) {
+        codec::encode_append(encoded_result, binary, num_whole);
+    }
+    m_num_pending = binary_size - num_whole;
+    memcpy(m_pending, binary + num_whole, m_num_pending);
+}
+
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::encoder::update(
+        const char* binary, size_t binary_size, Result& encoded_result)
+{
+    update(reinterpret_cast<const uint8_t*>(binary), binary_size, encoded_result);
+}
+
+template <typename CodecImpl>
+template <typename T, typename Result, typename non_numeric<T>::type*>
+inline void codec<CodecImpl>::encoder::update(const T& binary, Result& encoded_result)
+{
+    update(data::uchar_data(binary), data::size(binary), encoded_result);
+}
+
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::encoder::finish(Result& encoded_result)
+{
+    codec::encode_append(encoded_result, m_pending, m_num_pending);
+    m_num_pending = 0;
+}
+
 
 //
 // Decoding
@@ -263,7 +606,7 @@ template <typename Result>
 inline void codec<CodecImpl>::decode(Result& binary_result, const char* encoded, size_t encoded_size)
 {
     // This overload is where we reserve buffer capacity and call into CodecImpl.
-    size_t binary_buffer_size = decoded_max_size(encoded_size);
+    size_t binary_buffer_size = decoded_size(encoded, encoded_size);
     auto state = data::create_state(binary_result, data::specific_t());
     data::init(binary_result, state, binary_buffer_size);
 
@@ -280,6 +623,74 @@ inline void codec<CodecImpl>::decode(Result& binary_result, const T& encoded)
     decode(binary_result, data::char_data(encoded), data::size(encoded));
 }
 
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::decode_append(
+        Result& binary_result, const char* encoded, size_t encoded_size)
+{
+    size_t binary_buffer_size = decoded_size(encoded, encoded_size);
+    size_t previous_size = data::size(binary_result);
+    auto state = data::create_state(binary_result, data::specific_t());
+    data::init_append(binary_result, state, binary_buffer_size);
+
+    try {
+        CodecImpl::decode(binary_result, state, encoded, encoded_size);
+    } catch (...) {
+        // Don't leave partially decoded data behind the previous contents.
+        data::truncate(binary_result, state, previous_size);
+        throw;
+    }
+    data::finish(binary_result, state);
+    assert(data::size(binary_result) <= previous_size + binary_buffer_size);
+}
+
+template <typename CodecImpl>
+template <typename Result, typename T, typename non_numeric<T>::type*>
+inline void codec<CodecImpl>::decode_append(Result& binary_result, const T& encoded)
+{
+    decode_append(binary_result, data::char_data(encoded), data::size(encoded));
+}
+
+template <typename CodecImpl>
+template <size_t N>
+inline std::array<uint8_t, N> codec<CodecImpl>::decode(const char* encoded, size_t encoded_size)
+{
+    std::array<uint8_t, N> binary_result;
+    data::raw_result_buffer binary(reinterpret_cast<char*>(binary_result.data()), N);
+    binary.resize(0);
+    data::empty_result_state state;
+
+    if (encoded_size == codec::encoded_size(N)
+            && CodecImpl::template decode_fixed<N>(binary, state, encoded)) {
+        return binary_result;
+    }
+    // Anything else, e.g. with ignored characters, goes through the regular decoder.
+    // Only input with eof characters might fit despite a larger decoded_size().
+    size_t binary_size = 0;
+    if (decoded_size(encoded, encoded_size) <= N) {
+        binary.resize(0);
+        CodecImpl::decode(binary, state, encoded, encoded_size);
+        binary_size = data::size(binary);
+    } else {
+        std::vector<uint8_t> decoded = decode(encoded, encoded_size);
+        binary_size = decoded.size();
+        if (binary_size == N) {
+            memcpy(binary_result.data(), decoded.data(), N);
+        }
+    }
+    if (binary_size != N) {
+        throw invalid_input_length("parse error: decoded size doesn't match the fixed-size result");
+    }
+    return binary_result;
+}
+
+template <typename CodecImpl>
+template <size_t N, typename T>
+inline std::array<uint8_t, N> codec<CodecImpl>::decode(const T& encoded)
+{
+    return decode<N>(data::char_data(encoded), data::size(encoded));
+}
+
 template <typename CodecImpl>
 inline size_t codec<CodecImpl>::decode(
         uint8_t* binary_result, size_t binary_buffer_size,
@@ -314,12 +725,252 @@ inline size_t codec<CodecImpl>::decode(char* binary_result, size_t binary_buffer
     return decode(binary_result, binary_buffer_size, data::char_data(encoded), data::size(encoded));
 }
 
+template <typename CodecImpl>
+template <typename Result>
+inline decode_result codec<CodecImpl>::try_decode(
+        Result& binary_result, const char* encoded, size_t encoded_size) noexcept
+{
+    size_t binary_buffer_size = decoded_size(encoded, encoded_size);
+    auto state = data::create_state(binary_result, data::specific_t());
+    data::init(binary_result, state, binary_buffer_size);
+
+    typename CodecImpl::decode_progress progress;
+    const char* error_position = CodecImpl::try_decode(
+            binary_result, state, progress, encoded, encoded_size);
+    data::finish(binary_result, state);
+    assert(data::size(binary_result) <= binary_buffer_size);
+
+    return decode_result{ progress.error,
+            static_cast<size_t>(error_position - encoded), data::size(binary_result) };
+}
+
+template <typename CodecImpl>
+template <typename Result, typename T, typename non_numeric<T>::type*>
+inline decode_result codec<CodecImpl>::try_decode(Result& binary_result, const T& encoded) noexcept
+{
+    return try_decode(binary_result, data::char_data(encoded), data::size(encoded));
+}
+
+template <typename CodecImpl>
+inline decode_result codec<CodecImpl>::try_decode(
+        uint8_t* binary_result, size_t binary_buffer_size,
+        const char* encoded, size_t encoded_size) noexcept
+{
+    return try_decode(reinterpret_cast<char*>(binary_result), binary_buffer_size, encoded, encoded_size);
+}
+
+template <typename CodecImpl>
+inline decode_result codec<CodecImpl>::try_decode(
+        char* binary_result, size_t binary_buffer_size,
+        const char* encoded, size_t encoded_size) noexcept
+{
+    data::raw_result_buffer binary(binary_result, binary_buffer_size);
+    return try_decode(binary, encoded, encoded_size);
+}
+
+template <typename CodecImpl>
+template <typename T>
+inline decode_result codec<CodecImpl>::try_decode(
+        uint8_t* binary_result, size_t binary_buffer_size, const T& encoded) noexcept
+{
+    return try_decode(reinterpret_cast<char*>(binary_result), binary_buffer_size, encoded);
+}
+
+template <typename CodecImpl>
+template <typename T>
+inline decode_result codec<CodecImpl>::try_decode(
+        char* binary_result, size_t binary_buffer_size, const T& encoded) noexcept
+{
+    return try_decode(binary_result, binary_buffer_size, data::char_data(encoded), data::size(encoded));
+}
+
+template <typename CodecImpl>
+template <typename Result, typename Offsets, typename Results, typename Encodeds>
+inline size_t codec<CodecImpl>::decode_batch(
+        Result& binary_result, Offsets& offsets, Results& results, const Encodeds& encodeds)
+{
+    return decode_batch_impl(binary_result, offsets, results, encodeds.size(), [&](size_t i) {
+        const auto& encoded = *(encodeds.begin() + i);
+        return std::make_pair(data::char_data(encoded), static_cast<size_t>(data::size(encoded)));
+    });
+}
+
+template <typename CodecImpl>
+template <typename Result, typename Offsets, typename Results>
+inline size_t codec<CodecImpl>::decode_batch(Result& binary_result, Offsets& offsets, Results& results,
+        const char* const* encodeds, const size_t* encoded_sizes, size_t num_encodeds)
+{
+    return decode_batch_impl(binary_result, offsets, results, num_encodeds, [&](size_t i) {
+        return std::make_pair(encodeds[i], encoded_sizes[i]);
+    });
+}
+
+template <typename CodecImpl>
+template <typename Result, typename Offsets, typename Results, typename Encoded>
+inline size_t codec<CodecImpl>::decode_batch_impl(Result& binary_result, Offsets& offsets, Results& results,
+        size_t num_encodeds, const Encoded& encoded)
+{
+    using offset_type = typename std::decay<decltype(offsets[0])>::type;
+
+    // Exact for valid inputs, so the result is only set up once for all of them.
+    size_t binary_buffer_size = 0;
+    for (size_t i = 0; i < num_encodeds; ++i) {
+        const auto input = encoded(i);
+        binary_buffer_size += decoded_size(input.first, input.second);
+    }
+    check_offset_range<offset_type>(binary_buffer_size);
+    offsets.resize(num_encodeds + 1);
+    results.resize(num_encodeds);
+
+    auto state = data::create_state(binary_result, data::specific_t());
+    data::init(binary_result, state, binary_buffer_size);
+
+    // Inputs are decoded directly into the result if possible, otherwise into a scratch buffer
+    // first. Either way, the bytes of invalid inputs are dropped again.
+    char* binary = data::reserve_span(binary_result, state, binary_buffer_size);
+    std::vector<char> scratch;
+    data::raw_result_buffer part(binary, binary ? binary_buffer_size : 0);
+    data::empty_result_state part_state;
+    size_t binary_size = 0;
+    size_t num_invalid = 0;
+
+    for (size_t i = 0; i < num_encodeds; ++i) {
+        const auto input = encoded(i);
+        const char* src = input.first;
+        size_t src_size = input.second;
+        offsets[i] = static_cast<offset_type>(binary_size);
+
+        if (!binary) {
+            // Not less than decoded_size(), without scanning the input for that again.
+            scratch.resize(decoded_max_size(src_size));
+            part = data::raw_result_buffer(scratch.data(), scratch.size());
+        }
+        part.resize(binary ? binary_size : 0);
+        size_t part_begin = part.size();
+
+        typename CodecImpl::decode_progress progress;
+        const char* error_position = CodecImpl::try_decode(part, part_state, progress, src, src_size);
+        size_t part_size = part.size() - part_begin;
+        results[i] = decode_result{ progress.error, static_cast<size_t>(error_position - src), part_size };
+
+        if (progress.error != decode_error::none) {
+            ++num_invalid;
+            continue;
+        }
+        if (!binary) {
+            data::put_span(binary_result, state, scratch.data(), part_size);
+        }
+        binary_size += part_size;
+    }
+    offsets[num_encodeds] = static_cast<offset_type>(binary_size);
+
+    if (binary) {
+        data::commit(binary_result, state, binary_size);
+    }
+    data::finish(binary_result, state);
+    assert(data::size(binary_result) == binary_size);
+    return num_invalid;
+}
+
+template <typename CodecImpl>
+inline decode_result codec<CodecImpl>::validate(const char* encoded, size_t encoded_size) noexcept
+{
+    typename CodecImpl::decode_progress progress;
+    size_t decoded_size = 0;
+    const char* error_position = CodecImpl::validate(progress, decoded_size, encoded, encoded_size);
+    return decode_result{ progress.error, static_cast<size_t>(error_position - encoded), decoded_size };
+}
+
+template <typename CodecImpl>
+template <typename T>
+inline decode_result codec<CodecImpl>::validate(const T& encoded) noexcept
+{
+    return validate(data::char_data(encoded), data::size(encoded));
+}
+
 template <typename CodecImpl>
 inline constexpr size_t codec<CodecImpl>::decoded_max_size(size_t encoded_size) noexcept
 {
     return CodecImpl::decoded_max_size(encoded_size);
 }
 
+template <typename CodecImpl>
+inline size_t codec<CodecImpl>::decoded_size(const char* encoded, size_t encoded_size) noexcept
+{
+    return CodecImpl::decoded_size(encoded, encoded_size);
+}
+
+template <typename CodecImpl>
+template <typename T>
+inline size_t codec<CodecImpl>::decoded_size(const T& encoded) noexcept
+{
+    return decoded_size(data::char_data(encoded), data::size(encoded));
+}
+
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::decoder::update(
+        const char* encoded, size_t encoded_size, Result& binary_result)
+{
+    // Symbols carried over from the previous call might complete another block.
+    size_t binary_buffer_size = decoded_max_size(encoded_size + CodecImpl::encoded_block_size());
+    size_t previous_size = data::size(binary_result);
+    auto state = data::create_state(binary_result, data::specific_t());
+    data::init_append(binary_result, state, binary_buffer_size);
+
+    const char* error_position = CodecImpl::decode_update(
+            binary_result, state, m_progress, encoded, encoded_size);
+    if (m_progress.error != decode_error::none) {
+        // Errors end the input, start over from scratch with the next update().
+        decode_progress progress = m_progress;
+        m_progress = decode_progress();
+        data::truncate(binary_result, state, previous_size);
+        CodecImpl::throw_decode_error(progress, error_position);
+    }
+    data::finish(binary_result, state);
+}
+
+template <typename CodecImpl>
+template <typename T, typename Result, typename non_numeric<T>::type*>
+inline void codec<CodecImpl>::decoder::update(const T& encoded, Result& binary_result)
+{
+    update(data::char_data(encoded), data::size(encoded), binary_result);
+}
+
+template <typename CodecImpl>
+template <typename Result>
+inline void codec<CodecImpl>::decoder::finish(Result& binary_result)
+{
+    decode_progress progress = m_progress;
+    m_progress = decode_progress();
+
+    size_t previous_size = data::size(binary_result);
+    auto state = data::create_state(binary_result, data::specific_t());
+    data::init_append(binary_result, state, decoded_max_size(CodecImpl::encoded_block_size()));
+
+    CodecImpl::decode_finish(binary_result, state, progress);
+    if (progress.error != decode_error::none) {
+        data::truncate(binary_result, state, previous_size);
+        CodecImpl::throw_decode_error(progress, nullptr);
+    }
+    data::finish(binary_result, state);
+}
+
+//
+// Introspection
+
+template <typename CodecImpl>
+inline simd_tier codec<CodecImpl>::encoder_simd_tier() noexcept
+{
+    return CodecImpl::encoder_simd_tier();
+}
+
+template <typename CodecImpl>
+inline simd_tier codec<CodecImpl>::decoder_simd_tier() noexcept
+{
+    return CodecImpl::decoder_simd_tier();
+}
+
 
 } // namespace detail
 } // namespace cppcodec
@@ -36,5 +36,21 @@
 #define CPPCODEC_ALWAYS_INLINE inline
 #endif
 
+// Vectorized x86 kernels are compiled for their instruction set with function attributes
+// and picked at runtime based on what the CPU supports, see cppcodec/simd.hpp.
+// Define CPPCODEC_NO_SIMD to only use scalar code.
+#if !defined(CPPCODEC_NO_SIMD) \
+        && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define CPPCODEC_X86_SIMD 1
+#define CPPCODEC_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define CPPCODEC_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#define CPPCODEC_X86_SIMD 1
+#define CPPCODEC_TARGET_SSE41
+#define CPPCODEC_TARGET_AVX2
+#endif
+#endif
+
 #endif // CPPCODEC_DETAIL_CONFIG_HPP
 
@@ -30,6 +30,7 @@
 
 #include "../data/access.hpp"
 #include "../parse_error.hpp"
+#include "hex_simd.hpp"
 #include "stream_codec.hpp"
 
 namespace cppcodec {
@@ -80,6 +81,13 @@ public:
         throw std::domain_error("invalid last encoding symbol index in a tail");
     }
 
+    // The only possible tail is a single symbol, which doesn't make up a whole byte.
+    static CPPCODEC_ALWAYS_INLINE constexpr const char* invalid_tail_size(size_t /*idx_len*/) noexcept
+    {
+        return "odd-length hex input is not supported by the streaming octet decoder, "
+                "use a place-based number decoder instead";
+    }
+
     template <typename Result, typename ResultState>
     static CPPCODEC_ALWAYS_INLINE void decode_block(
             Result& decoded, ResultState&, const alphabet_index_t* idx);
@@ -103,9 +111,7 @@ template <typename Result, typename ResultState>
 CPPCODEC_ALWAYS_INLINE void hex<CodecVariant>::decode_tail(
         Result&, ResultState&, const alphabet_index_t*, size_t)
 {
-    throw invalid_input_length(
-            "odd-length hex input is not supported by the streaming octet decoder, "
-            "use a place-based number decoder instead");
+    // Never called, invalid_tail_size() rejects all tails.
 }
 
 } // namespace detail
@@ -0,0 +1,373 @@
+/**
+ *  Copyright (C) 2026 agent
+ *  All rights reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ */
+
+#ifndef CPPCODEC_DETAIL_HEX_SIMD
+#define CPPCODEC_DETAIL_HEX_SIMD
+
+#include <stdint.h>
+
+#include "config.hpp"
+#include "stream_codec.hpp"
+#include "swar.hpp"
+
+#if CPPCODEC_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace cppcodec {
+namespace detail {
+
+template <typename CodecVariant> class hex;
+
+// The vector decoders classify symbols by range, which requires 0-9 followed by
+// six letters from a-f, with either case being accepted for decoding.
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr bool hex_symbols_in_sequence(alphabet_index_t idx, size_t count)
+{
+    return count == 0 || ((CodecVariant::symbol(idx) == static_cast<char>('0' + idx)
+                    || (idx >= 10 && CodecVariant::normalized_symbol(static_cast<char>('a' + idx - 10))
+                            == CodecVariant::symbol(idx)
+                        && CodecVariant::normalized_symbol(static_cast<char>('A' + idx - 10))
+                            == CodecVariant::symbol(idx)))
+            && hex_symbols_in_sequence<CodecVariant>(static_cast<alphabet_index_t>(idx + 1), count - 1));
+}
+
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr bool hex_has_standard_alphabet()
+{
+    return CodecVariant::alphabet_size() == 16 && hex_symbols_in_sequence<CodecVariant>(0, 16);
+}
+
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr bool hex_letters_in_sequence(alphabet_index_t idx)
+{
+    return idx == 16 || (CodecVariant::symbol(idx) == static_cast<char>(CodecVariant::symbol(10) + idx - 10)
+            && hex_letters_in_sequence<CodecVariant>(static_cast<alphabet_index_t>(idx + 1)));
+}
+
+// Encoding only relies on the order of symbols, so both lower- and upper-case letters work.
+template <typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE constexpr bool hex_has_sequential_alphabet()
+{
+    return CodecVariant::alphabet_size() == 16
+            && hex_symbols_in_sequence<CodecVariant>(0, 10) && hex_letters_in_sequence<CodecVariant>(10);
+}
+
+// Scalar tier.
+template <typename CodecVariant>
+class hex_swar
+{
+public:
+    // Encodes 8 bytes into 16 symbols per iteration, with two 64-bit stores.
+    static inline size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+
+        for (; src_end - src >= 8; src += 8, dst += 16) {
+            if (sequential_alphabet) {
+                swar_store_le64(dst, symbols(swar_load_le32(src)));
+                swar_store_le64(dst + 8, symbols(swar_load_le32(src + 4)));
+            } else {
+                const uint64_t word = swar_load_be64(src);
+                swar_store_le64(dst, swar_symbols<CodecVariant, 4>(word));
+                swar_store_le64(dst + 8, swar_symbols<CodecVariant, 4>(word << 32));
+            }
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+private:
+    static constexpr const bool sequential_alphabet = hex_has_sequential_alphabet<CodecVariant>();
+
+    // Computes the symbols of 4 bytes (src[0] in the least significant byte) arithmetically.
+    static CPPCODEC_ALWAYS_INLINE uint64_t symbols(uint32_t bytes)
+    {
+        // Give each input byte its own 16-bit slot, then split it into the high nibble
+        // in the slot's first (lower) byte and the low nibble in its second byte.
+        uint64_t nibbles = bytes;
+        nibbles = (nibbles | (nibbles << 16)) & 0x0000FFFF0000FFFFull;
+        nibbles = (nibbles | (nibbles << 8)) & 0x00FF00FF00FF00FFull;
+        nibbles = ((nibbles & 0x000F000F000F000Full) << 8) | ((nibbles >> 4) & 0x000F000F000F000Full);
+
+        // Add '0' to all nibbles, plus the distance to the first letter for 10-15.
+        const uint64_t is_letter = ((nibbles + 0x0606060606060606ull) >> 4) & 0x0101010101010101ull;
+        const uint64_t letter_offset = static_cast<uint8_t>(CodecVariant::symbol(10) - '0' - 10);
+        return nibbles + 0x3030303030303030ull + is_letter * letter_offset;
+    }
+};
+
+#if CPPCODEC_X86_SIMD
+
+// With only 16 symbols, the whole alphabet fits into a single byte shuffle.
+template <typename CodecVariant>
+class hex_sse41
+{
+public:
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i alphabet()
+    {
+        return _mm_setr_epi8(
+                CodecVariant::symbol(0), CodecVariant::symbol(1), CodecVariant::symbol(2),
+                CodecVariant::symbol(3), CodecVariant::symbol(4), CodecVariant::symbol(5),
+                CodecVariant::symbol(6), CodecVariant::symbol(7), CodecVariant::symbol(8),
+                CodecVariant::symbol(9), CodecVariant::symbol(10), CodecVariant::symbol(11),
+                CodecVariant::symbol(12), CodecVariant::symbol(13), CodecVariant::symbol(14),
+                CodecVariant::symbol(15));
+    }
+
+    // Encodes 16 bytes into 32 symbols per iteration.
+    static CPPCODEC_TARGET_SSE41 size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+        const __m128i symbols = alphabet();
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+
+        for (; src_end - src >= 16; src += 16, dst += 32) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i hi = _mm_shuffle_epi8(symbols, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+            const __m128i lo = _mm_shuffle_epi8(symbols, _mm_and_si128(in, nibble));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(hi, lo));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_unpackhi_epi8(hi, lo));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+    // Decodes 32 symbols into 16 bytes per iteration. Stops at the first vector that
+    // contains anything else than hex digits, without consuming it.
+    static CPPCODEC_TARGET_SSE41 size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        for (; src_end - src >= 32; src += 32, dst += 16) {
+            __m128i valid0, valid1;
+            const __m128i n0 = nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), valid0);
+            const __m128i n1 = nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16)), valid1);
+            if (_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF) {
+                break;
+            }
+            // Combine each pair of nibbles into a 16-bit (hi * 16 + lo), then pack into bytes.
+            const __m128i pair_weights = _mm_set1_epi16(0x0110);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(
+                    _mm_maddubs_epi16(n0, pair_weights), _mm_maddubs_epi16(n1, pair_weights)));
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+    // Checks 16 symbols per iteration like decode(), without decoding them.
+    static CPPCODEC_TARGET_SSE41 size_t scan(const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        for (; src_end - src >= 16; src += 16) {
+            __m128i valid;
+            nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF) {
+                break;
+            }
+        }
+        return static_cast<size_t>(src - src_begin);
+    }
+
+private:
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i in_range(__m128i in, char first, char last)
+    {
+        // Symbols are ASCII, so signed comparison is fine and rejects all bytes >= 0x80.
+        return _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8(static_cast<char>(first - 1))),
+                _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(last + 1)), in));
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_SSE41 __m128i nibbles(__m128i in, __m128i& valid)
+    {
+        // Setting the 0x20 bit turns upper-case letters into lower-case ones
+        // and leaves digits unchanged.
+        const __m128i folded = _mm_or_si128(in, _mm_set1_epi8(0x20));
+        const __m128i is_digit = in_range(in, '0', '9');
+        const __m128i is_letter = in_range(folded, 'a', 'f');
+        valid = _mm_or_si128(is_digit, is_letter);
+
+        const __m128i offsets = _mm_or_si128(_mm_and_si128(is_digit, _mm_set1_epi8('0')),
+                _mm_and_si128(is_letter, _mm_set1_epi8('a' - 10)));
+        return _mm_sub_epi8(folded, offsets);
+    }
+};
+
+template <typename CodecVariant>
+class hex_avx2
+{
+public:
+    // Encodes 32 bytes into 64 symbols per iteration.
+    static CPPCODEC_TARGET_AVX2 size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        const uint8_t* const src_begin = src;
+        const uint8_t* const src_end = src + src_size;
+        const __m256i symbols = _mm256_broadcastsi128_si256(hex_sse41<CodecVariant>::alphabet());
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+        for (; src_end - src >= 32; src += 32, dst += 64) {
+            // Byte unpacking works per 128-bit lane, so put input quadwords 0 and 1
+            // into the lower halves of the two lanes and quadwords 2 and 3 into the upper ones.
+            const __m256i in = _mm256_permute4x64_epi64(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), 0xD8);
+            const __m256i hi = _mm256_shuffle_epi8(symbols, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+            const __m256i lo = _mm256_shuffle_epi8(symbols, _mm256_and_si256(in, nibble));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_unpacklo_epi8(hi, lo));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), _mm256_unpackhi_epi8(hi, lo));
+        }
+        size_t num_bytes = static_cast<size_t>(src - src_begin);
+        return num_bytes + hex_sse41<CodecVariant>::encode(dst, src, src_size - num_bytes);
+    }
+
+    // Decodes 64 symbols into 32 bytes per iteration, see hex_sse41::decode().
+    static CPPCODEC_TARGET_AVX2 size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        for (; src_end - src >= 64; src += 64, dst += 32) {
+            __m256i valid0, valid1;
+            const __m256i n0 = nibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), valid0);
+            const __m256i n1 = nibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32)), valid1);
+            if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1) {
+                break;
+            }
+            // Packing works per 128-bit lane, which leaves the quadwords in 0, 2, 1, 3 order.
+            const __m256i pair_weights = _mm256_set1_epi16(0x0110);
+            const __m256i packed = _mm256_packus_epi16(
+                    _mm256_maddubs_epi16(n0, pair_weights), _mm256_maddubs_epi16(n1, pair_weights));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_permute4x64_epi64(packed, 0xD8));
+        }
+        size_t num_symbols = static_cast<size_t>(src - src_begin);
+        if (src_end - src >= 64) {
+            return num_symbols; // stopped early, leave the rest to the scalar decoder
+        }
+        return num_symbols + hex_sse41<CodecVariant>::decode(dst, src, src_size - num_symbols);
+    }
+
+    // Checks 64 symbols per iteration like decode(), without decoding them.
+    // The SSE4.1 kernel narrows down where the first non-hex character is.
+    static CPPCODEC_TARGET_AVX2 size_t scan(const char* src, size_t src_size)
+    {
+        const char* const src_begin = src;
+        const char* const src_end = src + src_size;
+
+        for (; src_end - src >= 64; src += 64) {
+            __m256i valid0, valid1;
+            nibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), valid0);
+            nibbles(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32)), valid1);
+            if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1) {
+                break;
+            }
+        }
+        size_t num_symbols = static_cast<size_t>(src - src_begin);
+        return num_symbols + hex_sse41<CodecVariant>::scan(src, src_size - num_symbols);
+    }
+
+private:
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i in_range(__m256i in, char first, char last)
+    {
+        return _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8(static_cast<char>(first - 1))),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), in));
+    }
+
+    static CPPCODEC_ALWAYS_INLINE CPPCODEC_TARGET_AVX2 __m256i nibbles(__m256i in, __m256i& valid)
+    {
+        const __m256i folded = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+        const __m256i is_digit = in_range(in, '0', '9');
+        const __m256i is_letter = in_range(folded, 'a', 'f');
+        valid = _mm256_or_si256(is_digit, is_letter);
+
+        const __m256i offsets = _mm256_or_si256(_mm256_and_si256(is_digit, _mm256_set1_epi8('0')),
+                _mm256_and_si256(is_letter, _mm256_set1_epi8('a' - 10)));
+        return _mm256_sub_epi8(folded, offsets);
+    }
+};
+
+#endif // CPPCODEC_X86_SIMD
+
+template <typename CodecVariant>
+struct simd_kernels<hex<CodecVariant>>
+#if CPPCODEC_X86_SIMD
+        : simd_tiered_kernels<hex_avx2<CodecVariant>, hex_sse41<CodecVariant>, hex_swar<CodecVariant>>
+#else
+        : scalar_kernels<hex_swar<CodecVariant>>
+#endif
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_encoder() { return CodecVariant::alphabet_size() == 16; }
+
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_decoder()
+    {
+#if CPPCODEC_X86_SIMD
+        return hex_has_standard_alphabet<CodecVariant>();
+#else
+        return false;
+#endif
+    }
+};
+
+#if defined(CPPCODEC_DECODE_PAIR_TABLES)
+
+// Decoded byte for two symbols, or 0x100 if either one is a stop character.
+template <typename CodecVariant>
+struct hex_pair_value
+{
+    using index_info = alphabet_index_info<CodecVariant>;
+
+    static CPPCODEC_ALWAYS_INLINE constexpr uint16_t for_indexes(alphabet_index_t first, alphabet_index_t second)
+    {
+        return ((first | second) & index_info::stop_character_mask)
+                ? 0x100 : static_cast<uint16_t>((first << 4) | second);
+    }
+};
+
+template <typename CodecVariant>
+struct pair_decoder<hex<CodecVariant>>
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool enabled() { return true; }
+
+    template <typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE bool decode_block(Result& decoded, ResultState& state, const char* src)
+    {
+        static constexpr const pair_lookup_table t =
+                make_pair_lookup_table<hex_pair_value<CodecVariant>>(
+                        alphabet_index_info<CodecVariant>::index_table(), gen_seq<256>());
+
+        const uint16_t value = t.rows[static_cast<uint8_t>(src[0])].values[static_cast<uint8_t>(src[1])];
+        if (value & 0x100) {
+            return false;
+        }
+        data::put(decoded, state, static_cast<uint8_t>(value));
+        return true;
+    }
+};
+
+#endif // CPPCODEC_DECODE_PAIR_TABLES
+
+} // namespace detail
+} // namespace cppcodec
+
+#endif // CPPCODEC_DETAIL_HEX_SIMD
@@ -28,14 +28,20 @@
 #include <limits>
 #include <stdlib.h> // for abort()
 #include <stdint.h>
+#include <string.h> // for memcpy()
 
+#include "../data/access.hpp"
+#include "../data/raw_result_buffer.hpp"
 #include "../parse_error.hpp"
+#include "../simd.hpp"
 #include "config.hpp"
 
 namespace cppcodec {
 namespace detail {
 
-using alphabet_index_t = uint_fast16_t;
+// Alphabet indexes use the lower 6 bits, stop characters (padding, invalid, eof) the upper two.
+// Keeping them in a byte makes each variant's lookup table fit into four cache lines.
+using alphabet_index_t = uint8_t;
 
 template <typename Codec, typename CodecVariant>
 class stream_codec
@@ -47,8 +53,70 @@ public:
     template <typename Result, typename ResultState> static void decode(
             Result& binary_result, ResultState&, const char* encoded, size_t encoded_size);
 
+    // Decoding split into several calls: decode() is decode_update() followed by decode_finish().
+    // Both report invalid input through progress.error instead of throwing, decode_update()
+    // returns the position of the offending character (or the end of the input).
+    struct decode_progress {
+        alphabet_index_t indexes[Codec::encoded_block_size()];
+        uint8_t num_symbols = 0; // alphabet symbols in indexes, not yet decoded
+        uint8_t num_padding = 0; // padding characters read after those symbols
+        bool at_eof = false; // any input after an eof symbol is ignored
+        decode_error error = decode_error::none;
+    };
+    template <typename Result, typename ResultState> static const char* decode_update(
+            Result& binary_result, ResultState&, decode_progress& progress,
+            const char* encoded, size_t encoded_size);
+    template <typename Result, typename ResultState> static void decode_finish(
+            Result& binary_result, ResultState&, decode_progress& progress);
+
+    // Versions of encode() and decode() for binary sizes known at compile time, e.g. digests,
+    // with all loops and tail handling resolved at compile time. decode_fixed() only accepts
+    // the encoded_size(N) characters of a regular encoding, and returns false (possibly after
+    // decoding part of it) for anything else, which is then left for decode() to deal with.
+    template <size_t N, typename Result, typename ResultState> static void encode_fixed(
+            Result& encoded_result, ResultState&, const uint8_t* binary);
+    template <size_t N, typename Result, typename ResultState> static bool decode_fixed(
+            Result& binary_result, ResultState&, const char* encoded);
+
+    // Same as decode(), but leaves errors in progress.error. Returns the error position.
+    template <typename Result, typename ResultState> static const char* try_decode(
+            Result& binary_result, ResultState&, decode_progress& progress,
+            const char* encoded, size_t encoded_size);
+
+    // Checks the input like try_decode() without storing the decoded bytes, of which there
+    // would be decoded_size. Returns the error position.
+    static const char* validate(decode_progress& progress, size_t& decoded_size,
+            const char* encoded, size_t encoded_size);
+
+    // Throws the exception that decode() reports for progress.error.
+    [[noreturn]] static void throw_decode_error(
+            const decode_progress& progress, const char* error_position);
+
     static constexpr size_t encoded_size(size_t binary_size) noexcept;
     static constexpr size_t decoded_max_size(size_t encoded_size) noexcept;
+    static size_t decoded_size(const char* encoded, size_t encoded_size) noexcept;
+    // Same, for callers that have already counted the ignored characters in encoded.
+    static size_t decoded_size(const char* encoded, size_t encoded_size, size_t num_ignored) noexcept;
+
+    // Number of characters for which CodecVariant::should_ignore() is true.
+    static size_t count_ignored(const char* src, size_t src_size) noexcept;
+    // Position right after the first num_symbols characters that aren't ignored, or src_end.
+    static const char* skip_symbols(const char* src, const char* src_end, size_t num_symbols) noexcept;
+
+    static simd_tier encoder_simd_tier() noexcept;
+    static simd_tier decoder_simd_tier() noexcept;
+
+private:
+    // Decodes whole blocks of alphabet symbols, returns a pointer to the first block that
+    // contains anything else (e.g. padding, ignored or invalid characters) or is incomplete.
+    template <typename Result, typename ResultState> static const char* decode_plain_blocks(
+            Result& binary_result, ResultState&, const char* src, const char* src_end);
+    template <typename Result, typename ResultState> static const char* decode_plain_block_loop(
+            Result& binary_result, ResultState&, const char* src, const char* src_end);
+    // Same as decode_plain_blocks(), but only checks the symbols without decoding them.
+    static const char* scan_plain_blocks(const char* src, const char* src_end);
+    // All stop character flags of the eight characters in word.
+    static CPPCODEC_ALWAYS_INLINE alphabet_index_t word_flags(uint64_t word);
 };
 
 template <bool GeneratesPadding> // default for CodecVariant::generates_padding() == false
@@ -113,6 +181,176 @@ struct enc<0> {
     }
 };
 
+// Vectorized kernels that process many blocks at once. Codecs can specialize this
+// to provide them; the default has none, so all input goes through enc<I> instead.
+template <typename Codec>
+struct simd_kernels
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_encoder() { return false; }
+    static CPPCODEC_ALWAYS_INLINE constexpr bool has_decoder() { return false; }
+
+    // Encodes as many whole blocks from src as the kernel can handle into dst,
+    // returns the number of bytes consumed (a multiple of the binary block size).
+    static size_t encode(char* dst, const uint8_t* src, size_t src_size);
+
+    // Decodes whole blocks from src into dst until the kernel runs out of input or
+    // encounters anything other than alphabet symbols (or ignored characters), which is
+    // then left for the scalar decoder to deal with. Returns the number of characters
+    // consumed and advances dst past the last decoded byte.
+    static size_t decode(uint8_t*& dst, const char* src, size_t src_size);
+
+    // Checks src like decode() without decoding anything, returns the number of characters
+    // that are whole blocks of alphabet symbols (possibly fewer than decode() would consume).
+    static size_t scan(const char* src, size_t src_size);
+
+    // The tier of the kernels that encode() and decode() currently dispatch to.
+    static simd_tier encoder_tier() noexcept { return simd_tier::scalar; }
+    static simd_tier decoder_tier() noexcept { return simd_tier::scalar; }
+};
+
+template <bool HasSimdEncoder> // default for simd_kernels<Codec>::has_encoder() == false
+struct simd_encoder {
+    template <typename Codec, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE const uint8_t* encode(
+            Result&, ResultState&, const uint8_t* src, const uint8_t*)
+    {
+        return src;
+    }
+
+    template <typename Codec>
+    static CPPCODEC_ALWAYS_INLINE simd_tier tier() noexcept { return simd_tier::scalar; }
+};
+
+template<> // specialization for simd_kernels<Codec>::has_encoder() == true
+struct simd_encoder<true> {
+    template <typename Codec, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE const uint8_t* encode(
+            Result& encoded, ResultState& state, const uint8_t* src, const uint8_t* src_end)
+    {
+        const size_t num_blocks = static_cast<size_t>(src_end - src) / Codec::binary_block_size();
+        if (char* dst = data::reserve_span(encoded, state, num_blocks * Codec::encoded_block_size())) {
+            size_t num_bytes = simd_kernels<Codec>::encode(dst, src, static_cast<size_t>(src_end - src));
+            data::commit(encoded, state,
+                    num_bytes / Codec::binary_block_size() * Codec::encoded_block_size());
+            return src + num_bytes;
+        }
+
+        // Otherwise, stage the kernel output and pass it on with put_span().
+        constexpr static const size_t StagedBlocks = 64;
+        char staged[StagedBlocks * Codec::encoded_block_size()];
+
+        while (src < src_end) {
+            size_t src_size = static_cast<size_t>(src_end - src);
+            if (src_size > StagedBlocks * Codec::binary_block_size()) {
+                src_size = StagedBlocks * Codec::binary_block_size();
+            }
+            size_t num_bytes = simd_kernels<Codec>::encode(staged, src, src_size);
+            if (!num_bytes) {
+                break;
+            }
+            data::put_span(encoded, state, staged,
+                    num_bytes / Codec::binary_block_size() * Codec::encoded_block_size());
+            src += num_bytes;
+        }
+        return src;
+    }
+
+    template <typename Codec>
+    static CPPCODEC_ALWAYS_INLINE simd_tier tier() noexcept { return simd_kernels<Codec>::encoder_tier(); }
+};
+
+template <bool HasSimdDecoder> // default for simd_kernels<Codec>::has_decoder() == false
+struct simd_decoder {
+    template <typename Codec, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE const char* decode(
+            Result&, ResultState&, const char* src, const char*)
+    {
+        return src;
+    }
+
+    template <typename Codec>
+    static CPPCODEC_ALWAYS_INLINE const char* scan(const char* src, const char*)
+    {
+        return src;
+    }
+
+    template <typename Codec>
+    static CPPCODEC_ALWAYS_INLINE simd_tier tier() noexcept { return simd_tier::scalar; }
+};
+
+template<> // specialization for simd_kernels<Codec>::has_decoder() == true
+struct simd_decoder<true> {
+    template <typename Codec, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE const char* decode(
+            Result& decoded, ResultState& state, const char* src, const char* src_end)
+    {
+        // Kernels write exactly the bytes they decode, which is at most this many.
+        const size_t max_bytes = static_cast<size_t>(src_end - src)
+                / Codec::encoded_block_size() * Codec::binary_block_size();
+        if (char* dst = data::reserve_span(decoded, state, max_bytes)) {
+            uint8_t* const dst_begin = reinterpret_cast<uint8_t*>(dst);
+            uint8_t* dst_end = dst_begin;
+            size_t num_consumed = simd_kernels<Codec>::decode(dst_end, src, static_cast<size_t>(src_end - src));
+            data::commit(decoded, state, static_cast<size_t>(dst_end - dst_begin));
+            return src + num_consumed;
+        }
+
+        // Otherwise, stage the kernel output and pass it on with put_span().
+        constexpr static const size_t StagedBlocks = 64;
+        uint8_t staged[StagedBlocks * Codec::binary_block_size()];
+
+        while (src < src_end) {
+            size_t src_size = static_cast<size_t>(src_end - src);
+            if (src_size > StagedBlocks * Codec::encoded_block_size()) {
+                src_size = StagedBlocks * Codec::encoded_block_size();
+            }
+            uint8_t* staged_end = staged;
+            size_t num_consumed = simd_kernels<Codec>::decode(staged_end, src, src_size);
+            data::put_span(decoded, state, reinterpret_cast<const char*>(staged),
+                    static_cast<size_t>(staged_end - staged));
+            if (!num_consumed) {
+                break; // not a whole vector left, or one that the scalar decoder has to handle
+            }
+            src += num_consumed;
+        }
+        return src;
+    }
+
+    template <typename Codec>
+    static CPPCODEC_ALWAYS_INLINE const char* scan(const char* src, const char* src_end)
+    {
+        return src + simd_kernels<Codec>::scan(src, static_cast<size_t>(src_end - src));
+    }
+
+    template <typename Codec>
+    static CPPCODEC_ALWAYS_INLINE simd_tier tier() noexcept { return simd_kernels<Codec>::decoder_tier(); }
+};
+
+// Result type for validate(), which only needs the number of decoded bytes.
+class decoded_size_counter
+{
+public:
+    CPPCODEC_ALWAYS_INLINE void push_back(uint8_t) { ++m_size; }
+    CPPCODEC_ALWAYS_INLINE void append(const char*, size_t size) { m_size += size; }
+    CPPCODEC_ALWAYS_INLINE size_t size() const { return m_size; }
+
+private:
+    size_t m_size = 0;
+};
+
+// Lookup tables that decode two symbols at once, for blocks that the vectorized kernels
+// didn't consume. Codecs can specialize this; the default looks up each symbol on its own.
+template <typename Codec>
+struct pair_decoder
+{
+    static CPPCODEC_ALWAYS_INLINE constexpr bool enabled() { return false; }
+
+    // Decodes one whole block from src if it consists of alphabet symbols only,
+    // returns false (without decoding anything) otherwise.
+    template <typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE bool decode_block(Result&, ResultState&, const char*) { return false; }
+};
+
 template <typename Codec, typename CodecVariant>
 template <typename Result, typename ResultState>
 inline void stream_codec<Codec, CodecVariant>::encode(
@@ -123,6 +361,10 @@ inline void stream_codec<Codec, CodecVariant>::encode(
 
     const uint8_t* src_end = src + src_size;
 
+    src = simd_encoder<simd_kernels<Codec>::has_encoder()>::template encode<Codec>(
+            encoded_result, state, src, src_end);
+    src_size = static_cast<size_t>(src_end - src);
+
     if (src_size >= Codec::binary_block_size()) {
         src_end -= Codec::binary_block_size();
 
@@ -166,7 +408,7 @@ struct gen_seq<0, Is...> : seq<Is...> {};
 
 template <size_t N>
 struct lookup_table_t {
-    alphabet_index_t lookup[N];
+    alignas(64) alphabet_index_t lookup[N];
     static constexpr size_t size = N;
 };
 
@@ -233,15 +475,53 @@ struct padding_searcher<CodecVariant, 0> { // terminating specialization
     static CPPCODEC_ALWAYS_INLINE constexpr bool exists_padding_symbol() { return false; }
 };
 
+template <typename CodecVariant, size_t I>
+struct ignored_searcher {
+    // See padding_searcher for the four symbols at once.
+    static_assert(I % 4 == 0, "I must be divisible by 4 to eventually end at 0");
+
+    static CPPCODEC_ALWAYS_INLINE constexpr char symbol(size_t offset)
+    {
+        return static_cast<char>(num_possible_values<char>() - I - offset);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE constexpr size_t num_ignored_symbols()
+    {
+        return (CodecVariant::should_ignore(symbol(4)) ? 1 : 0)
+                + (CodecVariant::should_ignore(symbol(3)) ? 1 : 0)
+                + (CodecVariant::should_ignore(symbol(2)) ? 1 : 0)
+                + (CodecVariant::should_ignore(symbol(1)) ? 1 : 0)
+                + ignored_searcher<CodecVariant, I - 4>::num_ignored_symbols();
+    }
+
+    // Any of the ignored symbols, '\0' if there are none.
+    static CPPCODEC_ALWAYS_INLINE constexpr char ignored_symbol()
+    {
+        return CodecVariant::should_ignore(symbol(4)) ? symbol(4)
+                : CodecVariant::should_ignore(symbol(3)) ? symbol(3)
+                : CodecVariant::should_ignore(symbol(2)) ? symbol(2)
+                : CodecVariant::should_ignore(symbol(1)) ? symbol(1)
+                : ignored_searcher<CodecVariant, I - 4>::ignored_symbol();
+    }
+};
+template <typename CodecVariant>
+struct ignored_searcher<CodecVariant, 0> { // terminating specialization
+    static CPPCODEC_ALWAYS_INLINE constexpr size_t num_ignored_symbols() { return 0; }
+    static CPPCODEC_ALWAYS_INLINE constexpr char ignored_symbol() { return '\0'; }
+};
+
 template <typename CodecVariant>
 struct alphabet_index_info
 {
     static constexpr const size_t num_possible_symbols = num_possible_values<char>();
 
-    static constexpr const alphabet_index_t padding_idx = 1 << 8;
-    static constexpr const alphabet_index_t invalid_idx = 1 << 9;
-    static constexpr const alphabet_index_t eof_idx = 1 << 10;
-    static constexpr const alphabet_index_t stop_character_mask = static_cast<alphabet_index_t>(~0xFFu);
+    static constexpr const alphabet_index_t padding_idx = 0x40;
+    static constexpr const alphabet_index_t invalid_idx = 0x80;
+    static constexpr const alphabet_index_t eof_idx = 0xC0;
+    static constexpr const alphabet_index_t stop_character_mask = 0xC0;
+
+    static_assert(CodecVariant::alphabet_size() <= padding_idx,
+            "alphabet indexes must not overlap with the stop character bits");
 
     static constexpr const bool padding_allowed = padding_searcher<
             CodecVariant, num_possible_symbols>::exists_padding_symbol();
@@ -250,6 +530,17 @@ struct alphabet_index_info
     {
         return padding_allowed;
     }
+
+    // Characters for which CodecVariant::should_ignore() is true.
+    static constexpr const size_t num_ignored_symbols = ignored_searcher<
+            CodecVariant, num_possible_symbols>::num_ignored_symbols();
+    static constexpr const char ignored_symbol = ignored_searcher<
+            CodecVariant, num_possible_symbols>::ignored_symbol();
+
+    static CPPCODEC_ALWAYS_INLINE constexpr bool allows_ignoring()
+    {
+        return num_ignored_symbols != 0;
+    }
     static CPPCODEC_ALWAYS_INLINE constexpr bool is_padding(alphabet_index_t idx)
     {
         return allows_padding() ? (idx == padding_idx) : false;
@@ -299,14 +590,20 @@ private:
 #endif
 
 public:
-    struct lookup {
-        static CPPCODEC_ALWAYS_INLINE alphabet_index_t for_symbol(char symbol)
-        {
+    // Index or stop character for each possible symbol, also for building other lookup tables.
+    static CPPCODEC_ALWAYS_INLINE constexpr lookup_table_t<num_possible_symbols> index_table()
+    {
 #if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 5
-            static constexpr const auto t = make_lookup_table<num_possible_symbols>(index_at());
+        return make_lookup_table<num_possible_symbols>(index_at());
 #else
-            static constexpr const auto t = make_lookup_table<num_possible_symbols>(&index_at);
+        return make_lookup_table<num_possible_symbols>(&index_at);
 #endif
+    }
+
+    struct lookup {
+        static CPPCODEC_ALWAYS_INLINE alphabet_index_t for_symbol(char symbol)
+        {
+            static constexpr const auto t = index_table();
             static_assert(t.size == num_possible_symbols,
                     "lookup table must cover each possible (character) symbol");
             return t.lookup[static_cast<uint8_t>(symbol)];
@@ -314,93 +611,387 @@ public:
     };
 };
 
+// A value for each pair of characters, e.g. for pair_decoder specializations.
+// PairValue::for_indexes(alphabet_index_t, alphabet_index_t) provides the values
+// based on the alphabet indexes (or stop characters) of both characters.
+struct pair_lookup_row {
+    uint16_t values[256];
+};
+
+struct pair_lookup_table {
+    pair_lookup_row rows[256]; // indexed by the first character
+};
+
+template <typename PairValue, unsigned... Is>
+constexpr pair_lookup_row make_pair_lookup_row(
+        const lookup_table_t<256>& indexes, alphabet_index_t first, seq<Is...>)
+{
+    return { { PairValue::for_indexes(first, indexes.lookup[Is])... } };
+}
+
+// Built one row at a time, gen_seq<65536> would exceed the default template recursion limits.
+template <typename PairValue, unsigned... Is>
+constexpr pair_lookup_table make_pair_lookup_table(const lookup_table_t<256>& indexes, seq<Is...>)
+{
+    return { { make_pair_lookup_row<PairValue>(indexes, indexes.lookup[Is], gen_seq<256>())... } };
+}
+
+// Tail block of encode_fixed() and decode_fixed(), with TailSize bytes.
+template <size_t TailSize>
+struct fixed_tail {
+    template <typename Codec, typename CodecVariant, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE void encode(Result& encoded, ResultState& state, const uint8_t* src)
+    {
+        constexpr static const auto num_symbols = Codec::num_encoded_tail_symbols(static_cast<uint8_t>(TailSize));
+
+        enc<Codec::encoded_block_size()>::template tail<Codec, CodecVariant>(encoded, state, src, num_symbols);
+        padder<CodecVariant::generates_padding()>::template pad<CodecVariant>(
+                encoded, state, Codec::encoded_block_size() - num_symbols);
+    }
+
+    template <typename Codec, typename CodecVariant, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE bool decode(Result& decoded, ResultState& state, const char* src)
+    {
+        using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+        constexpr static const size_t num_symbols = Codec::num_encoded_tail_symbols(static_cast<uint8_t>(TailSize));
+        constexpr static const size_t num_padding = CodecVariant::generates_padding()
+                ? Codec::encoded_block_size() - num_symbols : 0;
+
+        alphabet_index_t alphabet_indexes[Codec::encoded_block_size()];
+        alphabet_index_t flags = 0;
+        for (size_t i = 0; i < num_symbols; ++i) {
+            alphabet_indexes[i] = alphabet_index_lookup::for_symbol(src[i]);
+            flags |= alphabet_indexes[i];
+        }
+        for (size_t i = num_symbols; i < num_symbols + num_padding; ++i) {
+            if (!alphabet_index_info<CodecVariant>::is_padding(alphabet_index_lookup::for_symbol(src[i]))) {
+                return false;
+            }
+        }
+        if (flags & alphabet_index_info<CodecVariant>::stop_character_mask) {
+            return false;
+        }
+        Codec::decode_tail(decoded, state, alphabet_indexes, num_symbols);
+        return true;
+    }
+};
+
+template<> // specialization for whole blocks only
+struct fixed_tail<0> {
+    template <typename Codec, typename CodecVariant, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE void encode(Result&, ResultState&, const uint8_t*) { }
+
+    template <typename Codec, typename CodecVariant, typename Result, typename ResultState>
+    static CPPCODEC_ALWAYS_INLINE bool decode(Result&, ResultState&, const char*) { return true; }
+};
+
 //
 // At long last! The actual decode/encode functions.
 
+template <typename Codec, typename CodecVariant>
+template <typename Result, typename ResultState>
+inline const char* stream_codec<Codec, CodecVariant>::decode_plain_blocks(
+        Result& binary_result, ResultState& state, const char* src, const char* src_end)
+{
+    // Decoded bytes go straight into the result buffer if it supports that.
+    const size_t max_bytes = static_cast<size_t>(src_end - src)
+            / Codec::encoded_block_size() * Codec::binary_block_size();
+    if (char* dst = data::reserve_span(binary_result, state, max_bytes)) {
+        data::raw_result_buffer direct_result(dst, 0);
+        data::empty_result_state direct_state;
+        src = decode_plain_block_loop(direct_result, direct_state, src, src_end);
+        data::commit(binary_result, state, direct_result.size());
+        return src;
+    }
+    return decode_plain_block_loop(binary_result, state, src, src_end);
+}
+
+template <typename Codec, typename CodecVariant>
+template <typename Result, typename ResultState>
+inline const char* stream_codec<Codec, CodecVariant>::decode_plain_block_loop(
+        Result& binary_result, ResultState& state, const char* src, const char* src_end)
+{
+    if (pair_decoder<Codec>::enabled()) {
+        while (static_cast<size_t>(src_end - src) >= Codec::encoded_block_size()
+                && pair_decoder<Codec>::decode_block(binary_result, state, src)) {
+            src += Codec::encoded_block_size();
+        }
+        return src;
+    }
+
+    using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+    alphabet_index_t alphabet_indexes[Codec::encoded_block_size()];
+
+    while (static_cast<size_t>(src_end - src) >= Codec::encoded_block_size()) {
+        // Stop characters are the only indexes with any of the flag bits set, so the whole
+        // block can be checked at once after the lookup instead of symbol by symbol.
+        alphabet_index_t flags = 0;
+        for (size_t i = 0; i < Codec::encoded_block_size(); ++i) {
+            alphabet_indexes[i] = alphabet_index_lookup::for_symbol(src[i]);
+            flags |= alphabet_indexes[i];
+        }
+        if (flags & alphabet_index_info<CodecVariant>::stop_character_mask) {
+            break;
+        }
+        Codec::decode_block(binary_result, state, alphabet_indexes);
+        src += Codec::encoded_block_size();
+    }
+    return src;
+}
+
+template <typename Codec, typename CodecVariant>
+CPPCODEC_ALWAYS_INLINE alphabet_index_t stream_codec<Codec, CodecVariant>::word_flags(uint64_t word)
+{
+    using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+    return static_cast<alphabet_index_t>(
+            (alphabet_index_lookup::for_symbol(static_cast<char>(word))
+                    | alphabet_index_lookup::for_symbol(static_cast<char>(word >> 8))
+                    | alphabet_index_lookup::for_symbol(static_cast<char>(word >> 16))
+                    | alphabet_index_lookup::for_symbol(static_cast<char>(word >> 24)))
+            | (alphabet_index_lookup::for_symbol(static_cast<char>(word >> 32))
+                    | alphabet_index_lookup::for_symbol(static_cast<char>(word >> 40))
+                    | alphabet_index_lookup::for_symbol(static_cast<char>(word >> 48))
+                    | alphabet_index_lookup::for_symbol(static_cast<char>(word >> 56))));
+}
+
+template <typename Codec, typename CodecVariant>
+inline const char* stream_codec<Codec, CodecVariant>::scan_plain_blocks(const char* src, const char* src_end)
+{
+    using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+    static_assert(16 % Codec::encoded_block_size() == 0, "scanned characters must be whole blocks");
+
+    // Without anything to decode, the lookups are the bottleneck. Spelling them out for
+    // 16 characters at a time keeps the compiler from looping (and spilling) per character.
+    while (src_end - src >= 16) {
+        uint64_t words[2];
+        memcpy(words, src, 16);
+        if ((word_flags(words[0]) | word_flags(words[1]))
+                & alphabet_index_info<CodecVariant>::stop_character_mask) {
+            break;
+        }
+        src += 16;
+    }
+    while (static_cast<size_t>(src_end - src) >= Codec::encoded_block_size()) {
+        alphabet_index_t flags = 0;
+        for (size_t i = 0; i < Codec::encoded_block_size(); ++i) {
+            flags |= alphabet_index_lookup::for_symbol(src[i]);
+        }
+        if (flags & alphabet_index_info<CodecVariant>::stop_character_mask) {
+            break;
+        }
+        src += Codec::encoded_block_size();
+    }
+    return src;
+}
+
+template <typename Codec, typename CodecVariant>
+template <size_t N, typename Result, typename ResultState>
+inline void stream_codec<Codec, CodecVariant>::encode_fixed(
+        Result& encoded_result, ResultState& state, const uint8_t* src)
+{
+    using encoder = enc<Codec::encoded_block_size()>;
+    constexpr static const size_t num_blocks = N / Codec::binary_block_size();
+
+    if (N > 64) {
+        // Long enough for the vectorized kernels to be faster.
+        encode(encoded_result, state, src, N);
+        return;
+    }
+    for (size_t i = 0; i < num_blocks; ++i) {
+        encoder::template block<Codec, CodecVariant>(
+                encoded_result, state, src + i * Codec::binary_block_size());
+    }
+    fixed_tail<N % Codec::binary_block_size()>::template encode<Codec, CodecVariant>(
+            encoded_result, state, src + num_blocks * Codec::binary_block_size());
+}
+
+template <typename Codec, typename CodecVariant>
+template <size_t N, typename Result, typename ResultState>
+inline bool stream_codec<Codec, CodecVariant>::decode_fixed(
+        Result& binary_result, ResultState& state, const char* src)
+{
+    using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+    constexpr static const size_t num_blocks = N / Codec::binary_block_size();
+
+    if (N > 64) {
+        return false;
+    }
+    alphabet_index_t alphabet_indexes[Codec::encoded_block_size()];
+    for (size_t b = 0; b < num_blocks; ++b) {
+        alphabet_index_t flags = 0;
+        for (size_t i = 0; i < Codec::encoded_block_size(); ++i) {
+            alphabet_indexes[i] = alphabet_index_lookup::for_symbol(src[i]);
+            flags |= alphabet_indexes[i];
+        }
+        if (flags & alphabet_index_info<CodecVariant>::stop_character_mask) {
+            return false;
+        }
+        Codec::decode_block(binary_result, state, alphabet_indexes);
+        src += Codec::encoded_block_size();
+    }
+    return fixed_tail<N % Codec::binary_block_size()>::template decode<Codec, CodecVariant>(
+            binary_result, state, src);
+}
+
 template <typename Codec, typename CodecVariant>
 template <typename Result, typename ResultState>
 inline void stream_codec<Codec, CodecVariant>::decode(
         Result& binary_result, ResultState& state,
         const char* src_encoded, size_t src_size)
+{
+    decode_progress progress;
+    const char* error_position = try_decode(binary_result, state, progress, src_encoded, src_size);
+    if (progress.error != decode_error::none) {
+        throw_decode_error(progress, error_position);
+    }
+}
+
+template <typename Codec, typename CodecVariant>
+template <typename Result, typename ResultState>
+inline const char* stream_codec<Codec, CodecVariant>::try_decode(
+        Result& binary_result, ResultState& state, decode_progress& progress,
+        const char* src_encoded, size_t src_size)
+{
+    const char* error_position = decode_update(binary_result, state, progress, src_encoded, src_size);
+    if (progress.error == decode_error::none) {
+        decode_finish(binary_result, state, progress);
+    }
+    return error_position;
+}
+
+template <typename Codec, typename CodecVariant>
+inline const char* stream_codec<Codec, CodecVariant>::validate(
+        decode_progress& progress, size_t& decoded_size, const char* src_encoded, size_t src_size)
+{
+    // Whole blocks of regular symbols only need to be classified. The rest is decoded
+    // as usual (without keeping any bytes) in order to apply the same padding and tail rules.
+    const char* src_end = src_encoded + src_size;
+    const char* src = simd_decoder<simd_kernels<Codec>::has_decoder()>::template scan<Codec>(
+            src_encoded, src_end);
+    src = scan_plain_blocks(src, src_end);
+
+    decoded_size_counter counter;
+    data::empty_result_state state;
+    const char* error_position = try_decode(counter, state, progress, src, static_cast<size_t>(src_end - src));
+    decoded_size = static_cast<size_t>(src - src_encoded) / Codec::encoded_block_size()
+            * Codec::binary_block_size() + counter.size();
+    return error_position;
+}
+
+template <typename Codec, typename CodecVariant>
+inline void stream_codec<Codec, CodecVariant>::throw_decode_error(
+        const decode_progress& progress, const char* error_position)
+{
+    // Kept out of line from the decoding loops, which only record what went wrong.
+    switch (progress.error) {
+    case decode_error::invalid_symbol:
+        throw symbol_error(*error_position);
+    case decode_error::invalid_length:
+        throw invalid_input_length(Codec::invalid_tail_size(progress.num_symbols));
+    default:
+        throw padding_error();
+    }
+}
+
+template <typename Codec, typename CodecVariant>
+template <typename Result, typename ResultState>
+inline const char* stream_codec<Codec, CodecVariant>::decode_update(
+        Result& binary_result, ResultState& state, decode_progress& progress,
+        const char* src_encoded, size_t src_size)
 {
     using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
     const char* src = src_encoded;
     const char* src_end = src + src_size;
 
-    alphabet_index_t alphabet_indexes[Codec::encoded_block_size()] = {};
-    alphabet_indexes[0] = alphabet_index_info<CodecVariant>::eof_idx;
+    if (progress.at_eof) {
+        return src_end;
+    }
+
+    if (!progress.num_symbols && !progress.num_padding) {
+        // Whole blocks of regular symbols can go through a vectorized kernel, if available,
+        // and otherwise through a faster scalar loop that checks for stop characters once per block.
+        // Everything that needs special handling remains for the loop below.
+        src = simd_decoder<simd_kernels<Codec>::has_decoder()>::template decode<Codec>(
+                binary_result, state, src, src_end);
 
-    alphabet_index_t* const alphabet_index_start = &alphabet_indexes[0];
-    alphabet_index_t* const alphabet_index_end = &alphabet_indexes[Codec::encoded_block_size()];
-    alphabet_index_t* alphabet_index_ptr = &alphabet_indexes[0];
+        src = decode_plain_blocks(binary_result, state, src, src_end);
+    }
 
     while (src < src_end) {
-        if (CodecVariant::should_ignore(*src)) {
+        if (progress.num_padding) {
+            // We've read a (first) padding character. Only more padding or eof may follow.
+            alphabet_index_t idx = alphabet_index_lookup::for_symbol(*src);
+
+            if (alphabet_index_info<CodecVariant>::is_eof(idx)) {
+                progress.at_eof = true;
+                return src_end;
+            }
+            if (!alphabet_index_info<CodecVariant>::is_padding(idx)
+                    || progress.num_symbols + progress.num_padding == Codec::encoded_block_size()) {
+                progress.error = decode_error::invalid_padding;
+                return src;
+            }
+            ++progress.num_padding;
             ++src;
             continue;
         }
-        *alphabet_index_ptr = alphabet_index_lookup::for_symbol(*src);
-        if (alphabet_index_info<CodecVariant>::is_stop_character(*alphabet_index_ptr)) {
-            break;
-        }
-        ++src;
-        ++alphabet_index_ptr;
-
-        if (alphabet_index_ptr == alphabet_index_end) {
-            Codec::decode_block(binary_result, state, alphabet_indexes);
-            alphabet_index_ptr = alphabet_index_start;
-        }
-    }
 
-    if (alphabet_index_info<CodecVariant>::is_invalid(*alphabet_index_ptr)) {
-        throw symbol_error(*src);
-    }
-    ++src;
-
-    alphabet_index_t* last_index_ptr = alphabet_index_ptr;
-    if (alphabet_index_info<CodecVariant>::is_padding(*last_index_ptr)) {
-        if (last_index_ptr == alphabet_index_start) {
-            // Don't accept padding at the start of a block.
-            // The encoder should have omitted that padding altogether.
-            throw padding_error();
+        if (CodecVariant::should_ignore(*src)) {
+            ++src;
+            continue;
         }
-        // We're in here because we just read a (first) padding character. Try to read more.
-        // Count with last_index_ptr, but store in alphabet_index_ptr so we don't
-        // overflow the array in case the input data is too long.
-        ++last_index_ptr;
-        while (src < src_end) {
-            *alphabet_index_ptr = alphabet_index_lookup::for_symbol(*(src++));
+        alphabet_index_t idx = alphabet_index_lookup::for_symbol(*src);
 
-            if (alphabet_index_info<CodecVariant>::is_eof(*alphabet_index_ptr)) {
-                *alphabet_index_ptr = alphabet_index_info<CodecVariant>::padding_idx;
-                break;
+        if (alphabet_index_info<CodecVariant>::is_stop_character(idx)) {
+            if (alphabet_index_info<CodecVariant>::is_invalid(idx)) {
+                progress.error = decode_error::invalid_symbol;
+                return src;
             }
-            if (!alphabet_index_info<CodecVariant>::is_padding(*alphabet_index_ptr)) {
-                throw padding_error();
+            if (alphabet_index_info<CodecVariant>::is_padding(idx)) {
+                if (!progress.num_symbols) {
+                    // Don't accept padding at the start of a block.
+                    // The encoder should have omitted that padding altogether.
+                    progress.error = decode_error::invalid_padding;
+                    return src;
+                }
+                progress.num_padding = 1;
+                ++src;
+                continue;
             }
+            progress.at_eof = true;
+            return src_end;
+        }
+        ++src;
 
-            ++last_index_ptr;
-            if (last_index_ptr > alphabet_index_end) {
-                throw padding_error();
-            }
+        progress.indexes[progress.num_symbols++] = idx;
+        if (progress.num_symbols == Codec::encoded_block_size()) {
+            Codec::decode_block(binary_result, state, progress.indexes);
+            progress.num_symbols = 0;
         }
     }
+    return src_end;
+}
 
-    if (last_index_ptr != alphabet_index_start)  {
-        if ((CodecVariant::requires_padding()
-                    || alphabet_index_info<CodecVariant>::is_padding(*alphabet_index_ptr)
-                    ) && last_index_ptr != alphabet_index_end)
-        {
-            // If the input is not a multiple of the block size then the input is incorrect.
-            throw padding_error();
-        }
-        if (alphabet_index_ptr >= alphabet_index_end) {
-            abort();
-            return;
-        }
-        Codec::decode_tail(binary_result, state, alphabet_indexes,
-                static_cast<size_t>(alphabet_index_ptr - alphabet_index_start));
+template <typename Codec, typename CodecVariant>
+template <typename Result, typename ResultState>
+inline void stream_codec<Codec, CodecVariant>::decode_finish(
+        Result& binary_result, ResultState& state, decode_progress& progress)
+{
+    if (!progress.num_symbols && !progress.num_padding) {
+        return;
+    }
+    if ((CodecVariant::requires_padding() || progress.num_padding)
+            && progress.num_symbols + progress.num_padding != Codec::encoded_block_size())
+    {
+        // If the input is not a multiple of the block size then the input is incorrect.
+        progress.error = decode_error::invalid_padding;
+        return;
+    }
+    if (Codec::invalid_tail_size(progress.num_symbols)) {
+        progress.error = decode_error::invalid_length;
+        return;
     }
+    Codec::decode_tail(binary_result, state, progress.indexes, progress.num_symbols);
 }
 
 template <typename Codec, typename CodecVariant>
@@ -433,6 +1024,104 @@ inline constexpr size_t stream_codec<Codec, CodecVariant>::decoded_max_size(size
                             * C::binary_block_size() / C::encoded_block_size());
 }
 
+template <typename Codec, typename CodecVariant>
+inline size_t stream_codec<Codec, CodecVariant>::count_ignored(const char* src, size_t src_size) noexcept
+{
+    size_t num_ignored = 0;
+    size_t i = 0;
+
+    if (alphabet_index_info<CodecVariant>::num_ignored_symbols == 1) {
+        // With a single ignored symbol (e.g. Crockford's hyphen), skip to its first
+        // occurrence with memchr(), which is cheap for input that doesn't contain any.
+        const char ignored_symbol = alphabet_index_info<CodecVariant>::ignored_symbol;
+        const void* first = memchr(src, ignored_symbol, src_size);
+        if (!first) {
+            return 0;
+        }
+        i = static_cast<size_t>(static_cast<const char*>(first) - src);
+
+        // From there, count occurrences in eight characters at once: XOR turns them into
+        // zero bytes, and adding 0x7F to the lower seven bits of each byte sets the high
+        // bit of all others.
+        constexpr static const uint64_t ones = 0x0101010101010101ull;
+        constexpr static const uint64_t low_bits = 0x7F7F7F7F7F7F7F7Full;
+        const uint64_t pattern = ones * static_cast<uint8_t>(ignored_symbol);
+
+        for (; src_size - i >= 8; i += 8) {
+            uint64_t word;
+            memcpy(&word, src + i, 8);
+            word ^= pattern;
+            const uint64_t is_zero = ~(((word & low_bits) + low_bits) | word | low_bits);
+            num_ignored += static_cast<size_t>(((is_zero >> 7) * ones) >> 56);
+        }
+    }
+    for (; i < src_size; ++i) {
+        num_ignored += CodecVariant::should_ignore(src[i]) ? 1 : 0;
+    }
+    return num_ignored;
+}
+
+template <typename Codec, typename CodecVariant>
+inline const char* stream_codec<Codec, CodecVariant>::skip_symbols(
+        const char* src, const char* src_end, size_t num_symbols) noexcept
+{
+    if (!alphabet_index_info<CodecVariant>::allows_ignoring()) {
+        return (num_symbols < static_cast<size_t>(src_end - src)) ? src + num_symbols : src_end;
+    }
+    for (; num_symbols && src < src_end; ++src) {
+        num_symbols -= CodecVariant::should_ignore(*src) ? 0 : 1;
+    }
+    return src;
+}
+
+template <typename Codec, typename CodecVariant>
+inline size_t stream_codec<Codec, CodecVariant>::decoded_size(
+        const char* encoded, size_t encoded_size) noexcept
+{
+    return decoded_size(encoded, encoded_size,
+            alphabet_index_info<CodecVariant>::allows_ignoring() ? count_ignored(encoded, encoded_size) : 0);
+}
+
+template <typename Codec, typename CodecVariant>
+inline size_t stream_codec<Codec, CodecVariant>::decoded_size(
+        const char* encoded, size_t encoded_size, size_t num_ignored) noexcept
+{
+    using C = Codec;
+    using alphabet_index_lookup = typename alphabet_index_info<CodecVariant>::lookup;
+
+    // Trailing padding and eof characters don't decode to anything, and neither do
+    // ignored characters anywhere in the input. Anything else that isn't a symbol
+    // is an error, so the size is exact for valid input and an upper bound otherwise.
+    size_t num_symbols = encoded_size;
+    while (num_symbols) {
+        alphabet_index_t idx = alphabet_index_lookup::for_symbol(encoded[num_symbols - 1]);
+        if (!alphabet_index_info<CodecVariant>::is_padding(idx)
+                && !alphabet_index_info<CodecVariant>::is_eof(idx)) {
+            break;
+        }
+        --num_symbols;
+    }
+    // Trailing padding and eof characters are never ignored, so it doesn't matter whether
+    // num_ignored includes them in the count.
+    num_symbols -= (num_ignored < num_symbols) ? num_ignored : num_symbols;
+    // decoded_max_size() for padded codecs leaves out incomplete blocks, which are invalid there.
+    size_t size = (num_symbols / C::encoded_block_size() * C::binary_block_size())
+            + ((num_symbols % C::encoded_block_size()) * C::binary_block_size() / C::encoded_block_size());
+    return (size < decoded_max_size(encoded_size)) ? size : decoded_max_size(encoded_size);
+}
+
+template <typename Codec, typename CodecVariant>
+inline simd_tier stream_codec<Codec, CodecVariant>::encoder_simd_tier() noexcept
+{
+    return simd_encoder<simd_kernels<Codec>::has_encoder()>::template tier<Codec>();
+}
+
+template <typename Codec, typename CodecVariant>
+inline simd_tier stream_codec<Codec, CodecVariant>::decoder_simd_tier() noexcept
+{
+    return simd_decoder<simd_kernels<Codec>::has_decoder()>::template tier<Codec>();
+}
+
 } // namespace detail
 } // namespace cppcodec
 
@@ -0,0 +1,136 @@
+/**
+ *  Copyright (C) 2026 agent
+ *  All rights reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ */
+
+
+#ifndef CPPCODEC_DETAIL_SWAR
+#define CPPCODEC_DETAIL_SWAR
+
+#include <stdint.h>
+#include <string.h> // for memcpy()
+
+#include "config.hpp"
+#include "stream_codec.hpp"
+
+#if defined(_MSC_VER)
+#include <stdlib.h> // for _byteswap_ulong(), _byteswap_uint64()
+#endif
+
+// Word-at-a-time ("SIMD within a register") helpers for the scalar encoders.
+// Only little-endian targets that the compiler lets us detect get single word loads and
+// stores, others assemble words byte by byte.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define CPPCODEC_SWAR_LITTLE_ENDIAN 1
+#endif
+#elif defined(_MSC_VER) // all Windows targets are little-endian
+#define CPPCODEC_SWAR_LITTLE_ENDIAN 1
+#endif
+
+namespace cppcodec {
+namespace detail {
+
+// Loads 8 bytes as one word with src[0] in the most significant byte.
+CPPCODEC_ALWAYS_INLINE uint64_t swar_load_be64(const uint8_t* src)
+{
+#if CPPCODEC_SWAR_LITTLE_ENDIAN
+    uint64_t word;
+    memcpy(&word, src, sizeof(word));
+#if defined(_MSC_VER)
+    return _byteswap_uint64(word);
+#else
+    return __builtin_bswap64(word);
+#endif
+#else
+    uint64_t word = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        word = (word << 8) | src[i];
+    }
+    return word;
+#endif
+}
+
+// Loads 4 bytes as one word with src[0] in the most significant byte.
+CPPCODEC_ALWAYS_INLINE uint32_t swar_load_be32(const uint8_t* src)
+{
+#if CPPCODEC_SWAR_LITTLE_ENDIAN
+    uint32_t word;
+    memcpy(&word, src, sizeof(word));
+#if defined(_MSC_VER)
+    return _byteswap_ulong(word);
+#else
+    return __builtin_bswap32(word);
+#endif
+#else
+    return (static_cast<uint32_t>(src[0]) << 24) | (static_cast<uint32_t>(src[1]) << 16)
+            | (static_cast<uint32_t>(src[2]) << 8) | src[3];
+#endif
+}
+
+// Loads 4 bytes as one word with src[0] in the least significant byte.
+CPPCODEC_ALWAYS_INLINE uint32_t swar_load_le32(const uint8_t* src)
+{
+#if CPPCODEC_SWAR_LITTLE_ENDIAN
+    uint32_t word;
+    memcpy(&word, src, sizeof(word));
+    return word;
+#else
+    return (static_cast<uint32_t>(src[3]) << 24) | (static_cast<uint32_t>(src[2]) << 16)
+            | (static_cast<uint32_t>(src[1]) << 8) | src[0];
+#endif
+}
+
+// Stores 8 characters that are packed into a word with the first one in the least significant byte.
+CPPCODEC_ALWAYS_INLINE void swar_store_le64(char* dst, uint64_t word)
+{
+#if CPPCODEC_SWAR_LITTLE_ENDIAN
+    memcpy(dst, &word, sizeof(word));
+#else
+    for (size_t i = 0; i < 8; ++i, word >>= 8) {
+        dst[i] = static_cast<char>(word & 0xFF);
+    }
+#endif
+}
+
+template <typename CodecVariant, unsigned NumBits, unsigned I>
+CPPCODEC_ALWAYS_INLINE uint64_t swar_symbol(uint64_t word)
+{
+    return static_cast<uint64_t>(static_cast<uint8_t>(CodecVariant::symbol(static_cast<alphabet_index_t>(
+            (word >> (64 - NumBits * (I + 1))) & ((1u << NumBits) - 1))))) << (8 * I);
+}
+
+// Looks up the symbols for 8 indices of NumBits bits each, taken from the most significant
+// bits of word, and packs them for swar_store_le64(). Unrolled explicitly so that all shift
+// amounts are constants and the lookups don't depend on each other.
+template <typename CodecVariant, unsigned NumBits>
+CPPCODEC_ALWAYS_INLINE uint64_t swar_symbols(uint64_t word)
+{
+    return (swar_symbol<CodecVariant, NumBits, 0>(word) | swar_symbol<CodecVariant, NumBits, 1>(word))
+            | (swar_symbol<CodecVariant, NumBits, 2>(word) | swar_symbol<CodecVariant, NumBits, 3>(word))
+            | (swar_symbol<CodecVariant, NumBits, 4>(word) | swar_symbol<CodecVariant, NumBits, 5>(word))
+            | (swar_symbol<CodecVariant, NumBits, 6>(word) | swar_symbol<CodecVariant, NumBits, 7>(word));
+}
+
+} // namespace detail
+} // namespace cppcodec
+
+#endif // CPPCODEC_DETAIL_SWAR
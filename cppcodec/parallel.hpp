@@ -0,0 +1,454 @@
+/**
+ *  Copyright (C) 2026 agent
+ *  All rights reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ */
+
+#ifndef CPPCODEC_PARALLEL
+#define CPPCODEC_PARALLEL
+
+#include <assert.h>
+#include <stddef.h> // for size_t
+#include <stdint.h>
+#include <algorithm> // for std::find(), std::upper_bound()
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "data/access.hpp"
+#include "data/raw_result_buffer.hpp"
+#include "detail/codec.hpp"
+
+namespace cppcodec {
+
+// Parallel encoding and decoding split the input into chunks of (roughly) this many bytes.
+// Inputs with fewer than two chunks are encoded or decoded on the calling thread.
+constexpr size_t parallel_chunk_size = 1 << 20;
+
+// An executor is called as executor(num_tasks, task) and must call task(i) exactly once
+// for each i in [0, num_tasks), in any order and on any threads, returning when all are done.
+using parallel_task = std::function<void(size_t)>;
+
+// Executor with a fixed set of worker threads that pick tasks in order of their index.
+// The calling thread works on tasks as well. Calls from several threads are serialized,
+// tasks must not throw and must not call into the same thread pool.
+class thread_pool
+{
+public:
+    // Number of threads including the calling one, i.e. num_threads - 1 workers are started.
+    explicit thread_pool(unsigned num_threads = std::thread::hardware_concurrency());
+    ~thread_pool();
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    unsigned num_threads() const noexcept { return static_cast<unsigned>(m_workers.size()) + 1; }
+
+    void operator()(size_t num_tasks, const parallel_task& task);
+
+private:
+    void work();
+    void run_tasks();
+
+    std::mutex m_call_mutex; // held for a whole operator() call
+    std::mutex m_mutex; // protects everything below except m_next_task
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::vector<std::thread> m_workers;
+
+    const parallel_task* m_task = nullptr;
+    size_t m_num_tasks = 0;
+    std::atomic<size_t> m_next_task;
+    size_t m_num_busy = 0; // workers that haven't finished the current call yet
+    unsigned m_generation = 0; // incremented for each call that wakes up the workers
+    bool m_stopping = false;
+};
+
+// Encode chunks of large inputs concurrently, on default_thread_pool() or with the given executor,
+// e.g. cppcodec::encode_parallel<cppcodec::base64_rfc4648>(encoded, binary).
+// Resizes encoded_result before writing to it.
+template <typename Codec, typename Result>
+void encode_parallel(Result& encoded_result, const uint8_t* binary, size_t binary_size);
+template <typename Codec, typename Result>
+void encode_parallel(Result& encoded_result, const char* binary, size_t binary_size);
+template <typename Codec, typename Result, typename T, typename detail::non_numeric<T>::type* = nullptr>
+void encode_parallel(Result& encoded_result, const T& binary);
+template <typename Codec, typename Result, typename Executor>
+void encode_parallel(Result& encoded_result, const uint8_t* binary, size_t binary_size, Executor&& executor);
+template <typename Codec, typename Result, typename Executor>
+void encode_parallel(Result& encoded_result, const char* binary, size_t binary_size, Executor&& executor);
+template <typename Codec, typename Result, typename T, typename Executor,
+          typename detail::non_numeric<typename std::decay<Executor>::type>::type* = nullptr>
+void encode_parallel(Result& encoded_result, const T& binary, Executor&& executor);
+
+// Decode chunks of large inputs concurrently, on default_thread_pool() or with the given executor.
+// Resizes binary_result before writing to it.
+template <typename Codec, typename Result>
+void decode_parallel(Result& binary_result, const char* encoded, size_t encoded_size);
+template <typename Codec, typename Result, typename T, typename detail::non_numeric<T>::type* = nullptr>
+void decode_parallel(Result& binary_result, const T& encoded);
+template <typename Codec, typename Result, typename Executor>
+void decode_parallel(Result& binary_result, const char* encoded, size_t encoded_size, Executor&& executor);
+template <typename Codec, typename Result, typename T, typename Executor,
+          typename detail::non_numeric<typename std::decay<Executor>::type>::type* = nullptr>
+void decode_parallel(Result& binary_result, const T& encoded, Executor&& executor);
+
+namespace detail {
+
+// Implements the above for the codec classes, using CodecImpl's building blocks.
+template <typename Codec> class parallel_codec;
+
+template <typename CodecImpl>
+class parallel_codec<codec<CodecImpl>>
+{
+public:
+    template <typename Result, typename Executor>
+    static void encode(Result& encoded_result, const uint8_t* binary, size_t binary_size, Executor&& executor);
+    template <typename Result, typename Executor>
+    static void decode(Result& binary_result, const char* encoded, size_t encoded_size, Executor&& executor);
+};
+
+} // namespace detail
+
+// Shared thread pool for parallel encoding and decoding without an explicit executor,
+// started on first use with one thread per hardware thread.
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+inline thread_pool::thread_pool(unsigned num_threads)
+    : m_next_task(0)
+{
+    for (unsigned i = 1; i < num_threads; ++i) {
+        m_workers.emplace_back(&thread_pool::work, this);
+    }
+}
+
+inline thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+inline void thread_pool::operator()(size_t num_tasks, const parallel_task& task)
+{
+    if (m_workers.empty() || num_tasks <= 1) {
+        for (size_t i = 0; i < num_tasks; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> call_lock(m_call_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_num_tasks = num_tasks;
+        m_next_task.store(0, std::memory_order_relaxed);
+        m_num_busy = m_workers.size();
+        ++m_generation;
+    }
+    m_wake.notify_all();
+    run_tasks();
+
+    // All workers must be done before task goes out of scope, and before the next call
+    // changes m_generation again.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_num_busy == 0; });
+    m_task = nullptr;
+}
+
+inline void thread_pool::work()
+{
+    unsigned generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stopping || m_generation != generation; });
+            if (m_stopping) {
+                return;
+            }
+            generation = m_generation;
+        }
+        run_tasks();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_num_busy == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+inline void thread_pool::run_tasks()
+{
+    // m_task and m_num_tasks don't change until all workers have checked back in.
+    for (size_t i = m_next_task.fetch_add(1, std::memory_order_relaxed); i < m_num_tasks;
+            i = m_next_task.fetch_add(1, std::memory_order_relaxed)) {
+        (*m_task)(i);
+    }
+}
+
+//
+// Parallel encoding and decoding
+//
+
+template <typename Codec, typename Result>
+inline void encode_parallel(Result& encoded_result, const uint8_t* binary, size_t binary_size)
+{
+    encode_parallel<Codec>(encoded_result, binary, binary_size, default_thread_pool());
+}
+
+template <typename Codec, typename Result>
+inline void encode_parallel(Result& encoded_result, const char* binary, size_t binary_size)
+{
+    encode_parallel<Codec>(encoded_result, reinterpret_cast<const uint8_t*>(binary), binary_size);
+}
+
+template <typename Codec, typename Result, typename T, typename detail::non_numeric<T>::type*>
+inline void encode_parallel(Result& encoded_result, const T& binary)
+{
+    encode_parallel<Codec>(encoded_result, data::uchar_data(binary), data::size(binary));
+}
+
+template <typename Codec, typename Result, typename Executor>
+inline void encode_parallel(
+        Result& encoded_result, const uint8_t* binary, size_t binary_size, Executor&& executor)
+{
+    detail::parallel_codec<Codec>::encode(encoded_result, binary, binary_size,
+            std::forward<Executor>(executor));
+}
+
+template <typename Codec, typename Result, typename Executor>
+inline void encode_parallel(
+        Result& encoded_result, const char* binary, size_t binary_size, Executor&& executor)
+{
+    encode_parallel<Codec>(encoded_result, reinterpret_cast<const uint8_t*>(binary), binary_size,
+            std::forward<Executor>(executor));
+}
+
+template <typename Codec, typename Result, typename T, typename Executor,
+          typename detail::non_numeric<typename std::decay<Executor>::type>::type*>
+inline void encode_parallel(Result& encoded_result, const T& binary, Executor&& executor)
+{
+    encode_parallel<Codec>(encoded_result, data::uchar_data(binary), data::size(binary),
+            std::forward<Executor>(executor));
+}
+
+template <typename Codec, typename Result>
+inline void decode_parallel(Result& binary_result, const char* encoded, size_t encoded_size)
+{
+    decode_parallel<Codec>(binary_result, encoded, encoded_size, default_thread_pool());
+}
+
+template <typename Codec, typename Result, typename T, typename detail::non_numeric<T>::type*>
+inline void decode_parallel(Result& binary_result, const T& encoded)
+{
+    decode_parallel<Codec>(binary_result, data::char_data(encoded), data::size(encoded));
+}
+
+template <typename Codec, typename Result, typename Executor>
+inline void decode_parallel(
+        Result& binary_result, const char* encoded, size_t encoded_size, Executor&& executor)
+{
+    detail::parallel_codec<Codec>::decode(binary_result, encoded, encoded_size,
+            std::forward<Executor>(executor));
+}
+
+template <typename Codec, typename Result, typename T, typename Executor,
+          typename detail::non_numeric<typename std::decay<Executor>::type>::type*>
+inline void decode_parallel(Result& binary_result, const T& encoded, Executor&& executor)
+{
+    decode_parallel<Codec>(binary_result, data::char_data(encoded), data::size(encoded),
+            std::forward<Executor>(executor));
+}
+
+namespace detail {
+
+template <typename CodecImpl>
+template <typename Result, typename Executor>
+inline void parallel_codec<codec<CodecImpl>>::encode(
+        Result& encoded_result, const uint8_t* binary, size_t binary_size, Executor&& executor)
+{
+    // Whole blocks encode independently and without padding, so chunk i starts at
+    // i * chunk_size in the input and at i * encoded_size(chunk_size) in the output.
+    constexpr const size_t chunk_size = (parallel_chunk_size / CodecImpl::binary_block_size())
+            * CodecImpl::binary_block_size();
+    const size_t num_chunks = (binary_size + chunk_size - 1) / chunk_size;
+
+    size_t encoded_buffer_size = CodecImpl::encoded_size(binary_size);
+    auto state = data::create_state(encoded_result, data::specific_t());
+    data::init(encoded_result, state, encoded_buffer_size);
+
+    // Results that can't be written to directly are filled one character at a time.
+    char* encoded = (num_chunks >= 2)
+            ? data::reserve_span(encoded_result, state, encoded_buffer_size) : nullptr;
+    if (!encoded) {
+        CodecImpl::encode(encoded_result, state, binary, binary_size);
+    } else {
+        executor(num_chunks, parallel_task([=](size_t i) {
+            size_t chunk_binary_size = (i + 1 < num_chunks) ? chunk_size : binary_size - i * chunk_size;
+            codec<CodecImpl>::encode(encoded + i * CodecImpl::encoded_size(chunk_size),
+                    CodecImpl::encoded_size(chunk_binary_size), binary + i * chunk_size, chunk_binary_size);
+        }));
+        data::commit(encoded_result, state, encoded_buffer_size);
+    }
+    data::finish(encoded_result, state);
+    assert(data::size(encoded_result) == encoded_buffer_size);
+}
+
+template <typename CodecImpl>
+template <typename Result, typename Executor>
+inline void parallel_codec<codec<CodecImpl>>::decode(
+        Result& binary_result, const char* encoded, size_t encoded_size, Executor&& executor)
+{
+    const size_t num_chunks = (encoded_size + parallel_chunk_size - 1) / parallel_chunk_size;
+    const char* encoded_end = encoded + encoded_size;
+    // Results that can't be written to directly would be filled one byte at a time anyway.
+    if (num_chunks < 2 || !data::has_span<Result>()) {
+        codec<CodecImpl>::decode(binary_result, encoded, encoded_size);
+        return;
+    }
+
+    // Ignored characters don't map to any output, so first count the remaining characters
+    // of each chunk and add them up to find out where each chunk starts in terms of symbols.
+    std::vector<size_t> chunk_symbols(num_chunks + 1, 0);
+    executor(num_chunks, parallel_task([&](size_t i) {
+        size_t chunk_size = (i + 1 < num_chunks) ? parallel_chunk_size : encoded_size - i * parallel_chunk_size;
+        chunk_symbols[i + 1] = chunk_size - CodecImpl::count_ignored(encoded + i * parallel_chunk_size, chunk_size);
+    }));
+    for (size_t i = 0; i < num_chunks; ++i) {
+        chunk_symbols[i + 1] += chunk_symbols[i];
+    }
+    const size_t num_symbols = chunk_symbols[num_chunks];
+
+    // Each part starts with the first whole block in its chunk and ends before the next part,
+    // the last one also decodes the tail. Symbols counted here include padding and eof
+    // characters, but those only belong at the end of valid input anyway.
+    std::vector<size_t> part_symbols(1, 0);
+    for (size_t i = 1; i < num_chunks; ++i) {
+        size_t first_block = (chunk_symbols[i] + CodecImpl::encoded_block_size() - 1)
+                / CodecImpl::encoded_block_size() * CodecImpl::encoded_block_size();
+        if (first_block > part_symbols.back() && first_block < num_symbols) {
+            part_symbols.push_back(first_block);
+        }
+    }
+    part_symbols.push_back(num_symbols);
+    const size_t num_parts = part_symbols.size() - 1;
+    const size_t last_offset = part_symbols[num_parts - 1]
+            / CodecImpl::encoded_block_size() * CodecImpl::binary_block_size();
+
+    // Parts that start beyond the decoded size only occur with invalid input.
+    size_t binary_buffer_size = CodecImpl::decoded_size(encoded, encoded_size, encoded_size - num_symbols);
+    if (last_offset > binary_buffer_size) {
+        codec<CodecImpl>::decode(binary_result, encoded, encoded_size);
+        return;
+    }
+    auto state = data::create_state(binary_result, data::specific_t());
+    data::init(binary_result, state, binary_buffer_size);
+    char* binary = data::reserve_span(binary_result, state, binary_buffer_size);
+    if (!binary) {
+        CodecImpl::decode(binary_result, state, encoded, encoded_size);
+        data::finish(binary_result, state);
+        return;
+    }
+
+    auto position = [&](size_t symbol) -> const char* {
+        if (symbol >= num_symbols) {
+            return encoded_end;
+        }
+        size_t chunk = static_cast<size_t>(std::upper_bound(
+                chunk_symbols.begin(), chunk_symbols.end(), symbol) - chunk_symbols.begin()) - 1;
+        const char* chunk_begin = encoded + chunk * parallel_chunk_size;
+        const char* chunk_end = (chunk + 1 < num_chunks) ? chunk_begin + parallel_chunk_size : encoded_end;
+        return CodecImpl::skip_symbols(chunk_begin, chunk_end, symbol - chunk_symbols[chunk]);
+    };
+    auto part_offset = [&](size_t i) -> size_t {
+        return part_symbols[i] / CodecImpl::encoded_block_size() * CodecImpl::binary_block_size();
+    };
+
+    std::vector<uint8_t> part_failed(num_parts, 0);
+    size_t last_size = 0;
+    executor(num_parts, parallel_task([&](size_t i) {
+        const char* part_begin = position(part_symbols[i]);
+        const char* part_end = position(part_symbols[i + 1]);
+        size_t part_size = static_cast<size_t>(part_end - part_begin);
+        size_t offset = part_offset(i);
+        typename CodecImpl::decode_progress progress;
+        data::empty_result_state part_state;
+
+        if (i + 1 < num_parts) {
+            // Only whole blocks of symbols, which leave nothing over for decode_finish().
+            data::raw_result_buffer part(binary + offset, binary_buffer_size - offset);
+            part.resize(0);
+            CodecImpl::decode_update(part, part_state, progress, part_begin, part_size);
+            part_failed[i] = progress.error != decode_error::none || progress.num_symbols
+                    || progress.num_padding || progress.at_eof;
+            return;
+        }
+        if (CodecImpl::decoded_size(part_begin, part_size) > binary_buffer_size - offset) {
+            part_failed[i] = 1;
+            return;
+        }
+        data::raw_result_buffer part(binary + offset, binary_buffer_size - offset);
+        part.resize(0);
+        CodecImpl::try_decode(part, part_state, progress, part_begin, part_size);
+        part_failed[i] = progress.error != decode_error::none;
+        last_size = data::size(part);
+    }));
+
+    size_t first_failed = static_cast<size_t>(
+            std::find(part_failed.begin(), part_failed.end(), 1) - part_failed.begin());
+    if (first_failed < num_parts) {
+        // Padding or eof before the last part, or invalid input. The parts before this one
+        // decoded whole blocks just like decode() would have, so continue from there on
+        // the calling thread in order to report errors exactly like decode().
+        typename CodecImpl::decode_progress progress;
+        const char* part_begin = position(part_symbols[first_failed]);
+        data::commit(binary_result, state, part_offset(first_failed));
+        const char* error_position = CodecImpl::try_decode(binary_result, state, progress,
+                part_begin, static_cast<size_t>(encoded_end - part_begin));
+        data::finish(binary_result, state);
+        if (progress.error != decode_error::none) {
+            CodecImpl::throw_decode_error(progress, error_position);
+        }
+        assert(data::size(binary_result) <= binary_buffer_size);
+        return;
+    }
+    data::commit(binary_result, state, last_offset + last_size);
+    data::finish(binary_result, state);
+    assert(data::size(binary_result) <= binary_buffer_size);
+}
+
+} // namespace detail
+
+} // namespace cppcodec
+
+#endif // CPPCODEC_PARALLEL
@@ -24,6 +24,8 @@
 #ifndef CPPCODEC_PARSE_ERROR
 #define CPPCODEC_PARSE_ERROR
 
+#include <stddef.h> // for size_t
+#include <stdint.h>
 #include <stdexcept>
 #include <string>
 
@@ -104,6 +106,24 @@ public:
     padding_error(const padding_error&) = default;
 };
 
+// Errors as reported by try_decode(), which doesn't throw any of the above.
+enum class decode_error : uint8_t
+{
+    none = 0,
+    invalid_symbol, // symbol_error
+    invalid_padding, // padding_error
+    invalid_length, // invalid_input_length other than padding_error
+};
+
+struct decode_result
+{
+    decode_error error;
+    size_t error_offset; // of the offending character, or the input size if there is none
+    size_t size; // number of bytes written to the result, including those before an error
+
+    explicit operator bool() const noexcept { return error == decode_error::none; }
+};
+
 } // namespace cppcodec
 
 #endif // CPPCODEC_PARSE_ERROR
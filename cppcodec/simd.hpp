@@ -0,0 +1,372 @@
+/**
+ *  Copyright (C) 2026 agent
+ *  All rights reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ */
+
+#ifndef CPPCODEC_SIMD
+#define CPPCODEC_SIMD
+
+#include <atomic>
+#include <stddef.h> // for size_t
+#include <stdint.h>
+#include <stdlib.h> // for getenv()
+
+#include "detail/config.hpp"
+
+#if CPPCODEC_X86_SIMD
+#if defined(_MSC_VER)
+#include <intrin.h> // for __cpuid(), __cpuidex()
+#include <immintrin.h> // for _xgetbv()
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace cppcodec {
+
+// Instruction set tiers for vectorized kernels, in ascending order.
+enum class simd_tier : uint8_t
+{
+    scalar = 0,
+    sse41 = 1,
+    avx2 = 2,
+};
+
+namespace detail {
+
+#if CPPCODEC_X86_SIMD
+
+inline simd_tier detect_simd_tier() noexcept
+{
+    uint32_t regs[4] = { 0, 0, 0, 0 }; // eax, ebx, ecx, edx
+    uint32_t max_leaf = 0;
+    uint32_t leaf1_ecx = 0;
+    uint32_t leaf7_ebx = 0;
+    uint64_t xcr0 = 0;
+
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    max_leaf = static_cast<uint32_t>(info[0]);
+    if (max_leaf >= 1) {
+        __cpuid(info, 1);
+        leaf1_ecx = static_cast<uint32_t>(info[2]);
+    }
+    if (max_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        leaf7_ebx = static_cast<uint32_t>(info[1]);
+    }
+    if (leaf1_ecx & (1u << 27)) { // OSXSAVE
+        xcr0 = _xgetbv(0);
+    }
+    (void)regs;
+#else
+    max_leaf = __get_cpuid_max(0, nullptr);
+    if (max_leaf >= 1) {
+        __cpuid(1, regs[0], regs[1], regs[2], regs[3]);
+        leaf1_ecx = regs[2];
+    }
+    if (max_leaf >= 7) {
+        __cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+        leaf7_ebx = regs[1];
+    }
+    if (leaf1_ecx & (1u << 27)) { // OSXSAVE
+        uint32_t xcr0_lo, xcr0_hi;
+        __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0)); // xgetbv
+        xcr0 = (static_cast<uint64_t>(xcr0_hi) << 32) | xcr0_lo;
+    }
+#endif
+
+    // AVX2 also needs the OS to preserve the upper halves of ymm registers (XCR0 bits 1 and 2).
+    const bool has_avx = (leaf1_ecx & (1u << 28)) && (xcr0 & 0x6) == 0x6;
+    if (has_avx && (leaf7_ebx & (1u << 5))) {
+        return simd_tier::avx2;
+    }
+    if (leaf1_ecx & (1u << 19)) {
+        return simd_tier::sse41;
+    }
+    return simd_tier::scalar;
+}
+
+#else
+
+inline simd_tier detect_simd_tier() noexcept
+{
+    return simd_tier::scalar;
+}
+
+#endif // CPPCODEC_X86_SIMD
+
+inline bool equals_ignoring_case(const char* str, const char* lowercase) noexcept
+{
+    for (; *lowercase; ++str, ++lowercase) {
+        const char c = (*str >= 'A' && *str <= 'Z') ? static_cast<char>(*str - 'A' + 'a') : *str;
+        if (c != *lowercase) {
+            return false;
+        }
+    }
+    return !*str;
+}
+
+// The CPPCODEC_MAX_SIMD_TIER environment variable can be set to "scalar", "sse41" or "avx2"
+// (in any case) in order to limit the tier of kernels being used. Other values limit kernels
+// to the scalar tier, so that a mistyped limit can't end up enabling all of them.
+inline simd_tier simd_tier_limit_from_environment() noexcept
+{
+#if defined(_MSC_VER)
+#pragma warning(suppress: 4996) // getenv() is fine for reading a single setting once
+#endif
+    const char* limit = getenv("CPPCODEC_MAX_SIMD_TIER");
+    if (!limit || !*limit) {
+        return simd_tier::avx2;
+    }
+    return equals_ignoring_case(limit, "avx2") ? simd_tier::avx2
+            : (equals_ignoring_case(limit, "sse41") || equals_ignoring_case(limit, "sse4.1")) ? simd_tier::sse41
+            : simd_tier::scalar;
+}
+
+class simd_config
+{
+public:
+    static simd_config& instance() noexcept
+    {
+        static simd_config config;
+        return config;
+    }
+
+    simd_tier detected() const noexcept { return m_detected; }
+    simd_tier limit() const noexcept { return static_cast<simd_tier>(m_limit.load(std::memory_order_relaxed)); }
+
+    // Kernel selections are cached per codec and direction, and re-resolved
+    // whenever the generation doesn't match the one they were resolved for.
+    unsigned generation() const noexcept { return m_generation.load(std::memory_order_acquire); }
+
+    void set_limit(simd_tier limit) noexcept
+    {
+        m_limit.store(static_cast<uint8_t>(limit), std::memory_order_relaxed);
+        m_generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+private:
+    simd_config() noexcept
+        : m_detected(detect_simd_tier())
+        , m_limit(static_cast<uint8_t>(simd_tier_limit_from_environment()))
+        , m_generation(1)
+    {
+    }
+
+    const simd_tier m_detected;
+    std::atomic<uint8_t> m_limit;
+    std::atomic<unsigned> m_generation;
+};
+
+} // namespace detail
+
+// The best tier that the CPU (and operating system) supports.
+inline simd_tier detected_simd_tier() noexcept
+{
+    return detail::simd_config::instance().detected();
+}
+
+// Limit kernels to the given tier, e.g. simd_tier::scalar to turn off vectorization.
+// Tiers above detected_simd_tier() are never used regardless of this setting.
+// The initial limit is read from the CPPCODEC_MAX_SIMD_TIER environment variable.
+inline void set_max_simd_tier(simd_tier limit) noexcept
+{
+    detail::simd_config::instance().set_limit(limit);
+}
+
+inline simd_tier max_simd_tier() noexcept
+{
+    return detail::simd_config::instance().limit();
+}
+
+// The tier that kernels are selected for: the lower of detected and maximum tier.
+inline simd_tier active_simd_tier() noexcept
+{
+    return (max_simd_tier() < detected_simd_tier()) ? max_simd_tier() : detected_simd_tier();
+}
+
+inline const char* simd_tier_name(simd_tier tier) noexcept
+{
+    return (tier == simd_tier::avx2) ? "avx2"
+            : (tier == simd_tier::sse41) ? "sse4.1"
+            : "scalar";
+}
+
+namespace detail {
+
+using simd_encode_kernel = size_t (*)(char* dst, const uint8_t* src, size_t src_size);
+using simd_decode_kernel = size_t (*)(uint8_t*& dst, const char* src, size_t src_size);
+using simd_scan_kernel = size_t (*)(const char* src, size_t src_size);
+
+// Scalar tier for codecs without a word-at-a-time decoder: consume nothing
+// and leave all input to the block-wise scalar code.
+inline size_t scalar_decode_kernel(uint8_t*&, const char*, size_t) { return 0; }
+inline size_t scalar_scan_kernel(const char*, size_t) { return 0; }
+
+// Selects the kernel for the active tier on first use and caches it until the tier limit
+// changes. Kernels provides kernel_type (a function pointer type) and kernel_for(simd_tier).
+template <typename Kernels>
+class simd_dispatch
+{
+public:
+    using kernel_type = typename Kernels::kernel_type;
+
+    static CPPCODEC_ALWAYS_INLINE kernel_type kernel() noexcept
+    {
+        resolve_if_outdated();
+        return s_kernel.load(std::memory_order_relaxed);
+    }
+
+    static simd_tier tier() noexcept
+    {
+        resolve_if_outdated();
+        return static_cast<simd_tier>(s_tier.load(std::memory_order_relaxed));
+    }
+
+private:
+    static CPPCODEC_ALWAYS_INLINE void resolve_if_outdated() noexcept
+    {
+        const unsigned generation = simd_config::instance().generation();
+        if (s_generation.load(std::memory_order_acquire) != generation) {
+            resolve(generation);
+        }
+    }
+
+    static void resolve(unsigned generation) noexcept
+    {
+        // Concurrent resolutions for the same generation store the same values,
+        // so publishing kernel and tier before the generation is sufficient.
+        const simd_tier tier = active_simd_tier();
+        s_kernel.store(Kernels::kernel_for(tier), std::memory_order_relaxed);
+        s_tier.store(static_cast<uint8_t>(tier), std::memory_order_relaxed);
+        s_generation.store(generation, std::memory_order_release);
+    }
+
+    static std::atomic<kernel_type> s_kernel;
+    static std::atomic<uint8_t> s_tier;
+    static std::atomic<unsigned> s_generation; // 0: not resolved yet
+};
+
+template <typename Kernels>
+std::atomic<typename Kernels::kernel_type> simd_dispatch<Kernels>::s_kernel(nullptr);
+template <typename Kernels>
+std::atomic<uint8_t> simd_dispatch<Kernels>::s_tier(0);
+template <typename Kernels>
+std::atomic<unsigned> simd_dispatch<Kernels>::s_generation(0);
+
+template <typename Avx2, typename Sse41, typename Scalar>
+struct simd_encoders
+{
+    using kernel_type = simd_encode_kernel;
+
+    static kernel_type kernel_for(simd_tier tier) noexcept
+    {
+        return (tier == simd_tier::avx2) ? &Avx2::encode
+                : (tier == simd_tier::sse41) ? &Sse41::encode
+                : &Scalar::encode;
+    }
+};
+
+template <typename Avx2, typename Sse41>
+struct simd_decoders
+{
+    using kernel_type = simd_decode_kernel;
+
+    static kernel_type kernel_for(simd_tier tier) noexcept
+    {
+        return (tier == simd_tier::avx2) ? &Avx2::decode
+                : (tier == simd_tier::sse41) ? &Sse41::decode
+                : &scalar_decode_kernel;
+    }
+};
+
+template <typename Avx2, typename Sse41>
+struct simd_scanners
+{
+    using kernel_type = simd_scan_kernel;
+
+    static kernel_type kernel_for(simd_tier tier) noexcept
+    {
+        return (tier == simd_tier::avx2) ? &Avx2::scan
+                : (tier == simd_tier::sse41) ? &Sse41::scan
+                : &scalar_scan_kernel;
+    }
+};
+
+// Implements the encode(), decode() and scan() functions of simd_kernels<Codec> by dispatching
+// to the kernel classes for each tier. Scalar only needs an encoder. Codecs still need
+// to define has_encoder() and has_decoder(), which determine whether these are used at all.
+template <typename Avx2, typename Sse41, typename Scalar>
+struct simd_tiered_kernels
+{
+    using encoders = simd_dispatch<simd_encoders<Avx2, Sse41, Scalar>>;
+    using decoders = simd_dispatch<simd_decoders<Avx2, Sse41>>;
+    using scanners = simd_dispatch<simd_scanners<Avx2, Sse41>>;
+
+    static CPPCODEC_ALWAYS_INLINE size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        return encoders::kernel()(dst, src, src_size);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        return decoders::kernel()(dst, src, src_size);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE size_t scan(const char* src, size_t src_size)
+    {
+        return scanners::kernel()(src, src_size);
+    }
+
+    static simd_tier encoder_tier() noexcept { return encoders::tier(); }
+    static simd_tier decoder_tier() noexcept { return decoders::tier(); }
+};
+
+// Same as simd_tiered_kernels, for codecs (or builds) that only have the scalar encoder.
+template <typename Scalar>
+struct scalar_kernels
+{
+    static CPPCODEC_ALWAYS_INLINE size_t encode(char* dst, const uint8_t* src, size_t src_size)
+    {
+        return Scalar::encode(dst, src, src_size);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE size_t decode(uint8_t*& dst, const char* src, size_t src_size)
+    {
+        return scalar_decode_kernel(dst, src, src_size);
+    }
+
+    static CPPCODEC_ALWAYS_INLINE size_t scan(const char* src, size_t src_size)
+    {
+        return scalar_scan_kernel(src, src_size);
+    }
+
+    static simd_tier encoder_tier() noexcept { return simd_tier::scalar; }
+    static simd_tier decoder_tier() noexcept { return simd_tier::scalar; }
+};
+
+} // namespace detail
+
+} // namespace cppcodec
+
+#endif // CPPCODEC_SIMD
@@ -36,6 +36,9 @@
 // behavior for a given type, the other one being able to modify the
 // default behavior but also being more complex/intricate.
 //
+// (Appending to a string is also supported directly by encode_append() and
+// decode_append(), the wrapper here only serves as an example.)
+//
 // The overall approach is straightforward: Define a result type with
 // push_back(char) and size() methods, implement template specializations
 // for init() and finish() for the result type, and call encode()/decode()
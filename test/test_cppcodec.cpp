@@ -32,8 +32,16 @@
 #include <cppcodec/base64_url_unpadded.hpp>
 #include <cppcodec/hex_lower.hpp>
 #include <cppcodec/hex_upper.hpp>
+#include <cppcodec/parallel.hpp>
 #include <stdint.h>
+#include <ctype.h> // for tolower()
+#include <stdlib.h> // for getenv(), setenv()
 #include <string.h> // for memcmp()
+#include <algorithm> // for std::min()
+#include <atomic>
+#include <deque>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 TEST_CASE("Douglas Crockford's base32", "[base32][crockford]") {
@@ -989,3 +997,1062 @@ TEST_CASE("hex (uppercase)", "[hex][upper]") {
         REQUIRE_THROWS_AS(hex::decode("66-6F"), cppcodec::symbol_error); // no dashes
     }
 }
+
+// Deterministic pseudo-random data for inputs that are long enough to use vectorized kernels.
+static std::vector<uint8_t> make_test_data(size_t size)
+{
+    std::vector<uint8_t> data;
+    data.reserve(size);
+    uint32_t x = 0x12345678u;
+    for (size_t i = 0; i < size; ++i) {
+        x = x * 1103515245u + 12345u;
+        data.push_back(static_cast<uint8_t>(x >> 24));
+    }
+    return data;
+}
+
+// Encodes one block after another, which keeps inputs too short for any vectorized kernel.
+template <typename Codec>
+static std::string encode_blockwise(const std::vector<uint8_t>& binary, size_t binary_block_size)
+{
+    std::string encoded;
+    for (size_t i = 0; i < binary.size(); i += binary_block_size) {
+        size_t len = (binary.size() - i < binary_block_size) ? binary.size() - i : binary_block_size;
+        encoded += Codec::encode(binary.data() + i, len);
+    }
+    return encoded;
+}
+
+// Neither data() nor operator[], but several characters can be added at once.
+class appending_result
+{
+public:
+    void push_back(char c) { m_chars.push_back(c); }
+    void append(const char* chars, size_t num_chars)
+    {
+        m_chars.insert(m_chars.end(), chars, chars + num_chars);
+        ++m_num_appends;
+    }
+    void resize(size_t size) { m_chars.resize(size); }
+    void reserve(size_t capacity) { m_chars.reserve(capacity); }
+    size_t size() const { return m_chars.size(); }
+
+    std::string str() const { return std::string(m_chars.begin(), m_chars.end()); }
+    size_t num_appends() const { return m_num_appends; }
+
+private:
+    std::vector<char> m_chars;
+    size_t m_num_appends = 0;
+};
+
+template <typename Codec>
+static void check_bulk_encoding(size_t binary_block_size)
+{
+    for (size_t size = 0; size < 300; ++size) {
+        std::vector<uint8_t> binary = make_test_data(size);
+        std::string encoded = Codec::encode(binary);
+        REQUIRE(encoded.size() == Codec::encoded_size(size));
+        REQUIRE(encoded == encode_blockwise<Codec>(binary, binary_block_size));
+        REQUIRE(Codec::decode(encoded) == binary);
+    }
+    std::vector<uint8_t> binary = make_test_data(100000);
+    std::string expected = encode_blockwise<Codec>(binary, binary_block_size);
+    REQUIRE(Codec::encode(binary) == expected);
+
+    // Raw buffers are written to directly, containers without contiguous storage one symbol at a time.
+    std::vector<char> raw(Codec::encoded_size(binary.size()));
+    REQUIRE(Codec::encode(raw.data(), raw.size(), binary) == expected.size());
+    REQUIRE(std::string(raw.data(), raw.size()) == expected);
+    std::deque<char> deque = Codec::template encode<std::deque<char>>(binary);
+    REQUIRE(std::string(deque.begin(), deque.end()) == expected);
+
+    // Containers that grow without initializing their elements.
+    using uninitialized_chars = std::vector<char, cppcodec::data::default_init_allocator<char>>;
+    using uninitialized_bytes = std::vector<uint8_t, cppcodec::data::default_init_allocator<uint8_t>>;
+    uninitialized_chars chars = Codec::template encode<uninitialized_chars>(binary);
+    REQUIRE(std::string(chars.begin(), chars.end()) == expected);
+    uninitialized_bytes bytes = Codec::template decode<uninitialized_bytes>(expected);
+    REQUIRE(std::vector<uint8_t>(bytes.begin(), bytes.end()) == binary);
+
+    // Results with append() get whole runs of symbols at once.
+    appending_result appended = Codec::template encode<appending_result>(binary);
+    REQUIRE(appended.str() == expected);
+    REQUIRE(appended.num_appends() > 0);
+    REQUIRE(Codec::template decode<appending_result>(expected).str()
+            == std::string(binary.begin(), binary.end()));
+}
+
+// Errors must be reported the same way regardless of where in a long input they occur.
+template <typename Codec>
+static void check_bulk_decoding_errors(const std::string& encoded)
+{
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        std::string invalid = encoded;
+        invalid[i] = '*';
+        try {
+            Codec::decode(invalid);
+            FAIL("expected symbol_error");
+        } catch (const cppcodec::symbol_error& e) {
+            REQUIRE(e.symbol() == '*');
+        }
+
+        invalid[i] = '\xC3';
+        REQUIRE_THROWS_AS(Codec::decode(invalid), cppcodec::symbol_error);
+    }
+}
+
+template <typename Codec>
+static void check_bulk_padding_errors(const std::string& encoded)
+{
+    for (size_t i = 0; i + 1 < encoded.size(); ++i) {
+        std::string invalid = encoded;
+        invalid[i] = '=';
+        REQUIRE_THROWS_AS(Codec::decode(invalid), cppcodec::padding_error);
+    }
+}
+
+TEST_CASE("base64 bulk encoding", "[base64][simd]") {
+    SECTION("RFC 4648") {
+        check_bulk_encoding<cppcodec::base64_rfc4648>(3);
+    }
+    SECTION("URL-safe") {
+        check_bulk_encoding<cppcodec::base64_url>(3);
+    }
+    SECTION("unpadded URL-safe") {
+        check_bulk_encoding<cppcodec::base64_url_unpadded>(3);
+    }
+}
+
+TEST_CASE("base64 bulk decoding", "[base64][simd]") {
+    std::vector<uint8_t> binary = make_test_data(96);
+
+    SECTION("RFC 4648") {
+        using base64 = cppcodec::base64_rfc4648;
+        check_bulk_decoding_errors<base64>(base64::encode(binary));
+        check_bulk_padding_errors<base64>(base64::encode(binary));
+
+        // Padding is only allowed at the very end, not after a run of whole blocks.
+        REQUIRE_THROWS_AS(base64::decode(base64::encode(binary) + "===="), cppcodec::padding_error);
+        REQUIRE_THROWS_AS(base64::decode(base64::encode(binary) + "A"), cppcodec::padding_error);
+        REQUIRE(base64::decode(base64::encode(binary) + "AA==").size() == binary.size() + 1);
+    }
+    SECTION("URL-safe") {
+        using base64 = cppcodec::base64_url;
+        check_bulk_decoding_errors<base64>(base64::encode(binary));
+        check_bulk_padding_errors<base64>(base64::encode(binary));
+
+        // Make sure the other variant's special characters are not accepted.
+        REQUIRE_THROWS_AS(base64::decode(std::string(64, 'A') + "+"), cppcodec::symbol_error);
+        REQUIRE_THROWS_AS(base64::decode(std::string(64, 'A') + "/"), cppcodec::symbol_error);
+    }
+    SECTION("unpadded URL-safe") {
+        using base64 = cppcodec::base64_url_unpadded;
+        check_bulk_decoding_errors<base64>(base64::encode(binary));
+
+        REQUIRE_THROWS_AS(base64::decode(base64::encode(binary) + "A"),
+                cppcodec::invalid_input_length);
+        REQUIRE(base64::decode(base64::encode(binary) + "AA").size() == binary.size() + 1);
+    }
+}
+
+TEST_CASE("hex bulk encoding", "[hex][simd]") {
+    SECTION("lowercase") {
+        check_bulk_encoding<cppcodec::hex_lower>(1);
+    }
+    SECTION("uppercase") {
+        check_bulk_encoding<cppcodec::hex_upper>(1);
+    }
+}
+
+TEST_CASE("hex bulk decoding", "[hex][simd]") {
+    std::vector<uint8_t> binary = make_test_data(96);
+
+    SECTION("lowercase") {
+        using hex = cppcodec::hex_lower;
+        check_bulk_decoding_errors<hex>(hex::encode(binary));
+
+        // Mixed case input is fine, and odd lengths are still rejected after bulk decoding.
+        REQUIRE(hex::decode(cppcodec::hex_upper::encode(binary)) == binary);
+        std::vector<uint8_t> mixed(32, 0xAA);
+        mixed.resize(64, 0xFF);
+        REQUIRE(hex::decode(std::string(64, 'a') + std::string(64, 'F')) == mixed);
+        REQUIRE_THROWS_AS(hex::decode(hex::encode(binary) + "a"), cppcodec::invalid_input_length);
+    }
+    SECTION("uppercase") {
+        using hex = cppcodec::hex_upper;
+        check_bulk_decoding_errors<hex>(hex::encode(binary));
+
+        REQUIRE(hex::decode(cppcodec::hex_lower::encode(binary)) == binary);
+        REQUIRE_THROWS_AS(hex::decode(hex::encode(binary) + "A"), cppcodec::invalid_input_length);
+
+        // Characters adjacent to the valid ranges must not be mistaken for hex digits.
+        for (char c : std::string("/:@G`g")) {
+            REQUIRE_THROWS_AS(hex::decode(std::string(63, '0') + c), cppcodec::symbol_error);
+        }
+    }
+}
+
+TEST_CASE("base32 bulk encoding", "[base32][simd]") {
+    SECTION("Crockford") {
+        check_bulk_encoding<cppcodec::base32_crockford>(5);
+    }
+    SECTION("base32hex") {
+        check_bulk_encoding<cppcodec::base32_hex>(5);
+    }
+    SECTION("RFC 4648") {
+        check_bulk_encoding<cppcodec::base32_rfc4648>(5);
+    }
+}
+
+TEST_CASE("base32 bulk decoding", "[base32][simd]") {
+    std::vector<uint8_t> binary = make_test_data(100);
+
+    SECTION("Crockford") {
+        using base32 = cppcodec::base32_crockford;
+        std::string encoded = base32::encode(binary);
+        check_bulk_decoding_errors<base32>(encoded);
+
+        // Case folding and Crockford's symbol substitutions also apply to long inputs.
+        std::string substituted = encoded;
+        for (size_t i = 0; i < substituted.size(); ++i) {
+            char& c = substituted[i];
+            c = (c == '0') ? "oO"[i % 2] : (c == '1') ? "iIlL"[i % 4] : static_cast<char>(tolower(c));
+        }
+        REQUIRE(base32::decode(substituted) == binary);
+
+        // Hyphens are dropped anywhere, no matter how many there are.
+        for (size_t step = 1; step < 40; ++step) {
+            std::string hyphenated;
+            for (size_t i = 0; i < encoded.size(); ++i) {
+                if (i % step == 0) {
+                    hyphenated += (step % 2) ? "-" : "---";
+                }
+                hyphenated += encoded[i];
+            }
+            REQUIRE(base32::decode(hyphenated) == binary);
+        }
+        REQUIRE(base32::decode(std::string(100, '-') + encoded + std::string(100, '-')) == binary);
+        REQUIRE_THROWS_AS(base32::decode(std::string(40, '-') + encoded + "0"),
+                cppcodec::invalid_input_length);
+        REQUIRE_THROWS_AS(base32::decode(std::string(40, '-') + encoded + "U"), cppcodec::symbol_error);
+    }
+    SECTION("base32hex") {
+        using base32 = cppcodec::base32_hex;
+        std::string encoded = base32::encode(binary);
+        check_bulk_decoding_errors<base32>(encoded);
+        check_bulk_padding_errors<base32>(encoded);
+
+        std::string lowercase = encoded;
+        for (char& c : lowercase) {
+            c = static_cast<char>(tolower(c));
+        }
+        REQUIRE(base32::decode(lowercase) == binary);
+        REQUIRE_THROWS_AS(base32::decode(std::string(64, '0') + "W"), cppcodec::symbol_error);
+        REQUIRE_THROWS_AS(base32::decode(std::string(32, '0') + "-" + std::string(31, '0')),
+                cppcodec::symbol_error);
+    }
+    SECTION("RFC 4648") {
+        using base32 = cppcodec::base32_rfc4648;
+        std::string encoded = base32::encode(binary);
+        check_bulk_decoding_errors<base32>(encoded);
+        check_bulk_padding_errors<base32>(encoded);
+
+        std::string lowercase = encoded;
+        for (char& c : lowercase) {
+            c = static_cast<char>(tolower(c));
+        }
+        REQUIRE(base32::decode(lowercase) == binary);
+        REQUIRE_THROWS_AS(base32::decode(std::string(64, 'A') + "1"), cppcodec::symbol_error);
+    }
+}
+
+template <typename Codec>
+void check_simd_tiers()
+{
+    const cppcodec::simd_tier original_limit = cppcodec::max_simd_tier();
+    std::vector<uint8_t> binary = make_test_data(5000);
+
+    cppcodec::set_max_simd_tier(cppcodec::simd_tier::scalar);
+    REQUIRE(Codec::encoder_simd_tier() == cppcodec::simd_tier::scalar);
+    REQUIRE(Codec::decoder_simd_tier() == cppcodec::simd_tier::scalar);
+    std::vector<std::string> expected;
+    for (size_t size = 0; size < binary.size(); size += 1 + size / 4) {
+        expected.push_back(Codec::encode(binary.data(), size));
+    }
+
+    const cppcodec::simd_tier tiers[] = {
+        cppcodec::simd_tier::scalar, cppcodec::simd_tier::sse41, cppcodec::simd_tier::avx2 };
+    for (cppcodec::simd_tier tier : tiers) {
+        cppcodec::set_max_simd_tier(tier);
+        REQUIRE(Codec::encoder_simd_tier() <= tier);
+        REQUIRE(Codec::encoder_simd_tier() <= cppcodec::detected_simd_tier());
+        REQUIRE(Codec::decoder_simd_tier() <= tier);
+
+        size_t i = 0;
+        for (size_t size = 0; size < binary.size(); size += 1 + size / 4, ++i) {
+            REQUIRE(Codec::encode(binary.data(), size) == expected[i]);
+            REQUIRE(Codec::decode(expected[i]) == std::vector<uint8_t>(binary.begin(), binary.begin() + size));
+        }
+    }
+    cppcodec::set_max_simd_tier(original_limit);
+}
+
+TEST_CASE("SIMD tiers", "[simd]") {
+    REQUIRE(cppcodec::active_simd_tier() <= cppcodec::detected_simd_tier());
+    REQUIRE(cppcodec::active_simd_tier() <= cppcodec::max_simd_tier());
+    REQUIRE(std::string(cppcodec::simd_tier_name(cppcodec::simd_tier::scalar)) == "scalar");
+    REQUIRE(std::string(cppcodec::simd_tier_name(cppcodec::simd_tier::sse41)) == "sse4.1");
+    REQUIRE(std::string(cppcodec::simd_tier_name(cppcodec::simd_tier::avx2)) == "avx2");
+
+    SECTION("base64") {
+        check_simd_tiers<cppcodec::base64_rfc4648>();
+        check_simd_tiers<cppcodec::base64_url_unpadded>();
+    }
+    SECTION("base32") {
+        check_simd_tiers<cppcodec::base32_rfc4648>();
+        check_simd_tiers<cppcodec::base32_crockford>();
+    }
+    SECTION("hex") {
+        check_simd_tiers<cppcodec::hex_lower>();
+        check_simd_tiers<cppcodec::hex_upper>();
+    }
+    SECTION("limit") {
+        cppcodec::simd_tier original_limit = cppcodec::max_simd_tier();
+        cppcodec::set_max_simd_tier(cppcodec::simd_tier::scalar);
+        REQUIRE(cppcodec::active_simd_tier() == cppcodec::simd_tier::scalar);
+        cppcodec::set_max_simd_tier(cppcodec::simd_tier::avx2);
+        REQUIRE(cppcodec::active_simd_tier() == cppcodec::detected_simd_tier());
+        REQUIRE(cppcodec::base64_rfc4648::encoder_simd_tier() == cppcodec::detected_simd_tier());
+        REQUIRE(cppcodec::hex_lower::decoder_simd_tier() == cppcodec::detected_simd_tier());
+        cppcodec::set_max_simd_tier(original_limit);
+    }
+}
+
+static void set_simd_tier_environment(const char* value)
+{
+#if defined(_WIN32)
+    _putenv_s("CPPCODEC_MAX_SIMD_TIER", value ? value : "");
+#else
+    if (value) {
+        setenv("CPPCODEC_MAX_SIMD_TIER", value, 1);
+    } else {
+        unsetenv("CPPCODEC_MAX_SIMD_TIER");
+    }
+#endif
+}
+
+TEST_CASE("SIMD tier limit from the environment", "[simd][environment]") {
+#if defined(_MSC_VER)
+#pragma warning(suppress: 4996)
+#endif
+    const char* original = getenv("CPPCODEC_MAX_SIMD_TIER");
+    const std::string original_value = original ? original : "";
+
+    // Tests restore the limit they change, so it's still the one read on first use.
+    REQUIRE(cppcodec::max_simd_tier() == cppcodec::detail::simd_tier_limit_from_environment());
+    if (original_value == "no-such-tier") {
+        // Set up for this test by CMake, unknown values must not enable vectorized kernels.
+        REQUIRE(cppcodec::max_simd_tier() == cppcodec::simd_tier::scalar);
+        REQUIRE(cppcodec::active_simd_tier() == cppcodec::simd_tier::scalar);
+        REQUIRE(cppcodec::base64_rfc4648::encoder_simd_tier() == cppcodec::simd_tier::scalar);
+        REQUIRE(cppcodec::hex_lower::decoder_simd_tier() == cppcodec::simd_tier::scalar);
+    }
+
+    const std::pair<const char*, cppcodec::simd_tier> limits[] = {
+        { nullptr, cppcodec::simd_tier::avx2 },
+        { "", cppcodec::simd_tier::avx2 },
+        { "avx2", cppcodec::simd_tier::avx2 },
+        { "AVX2", cppcodec::simd_tier::avx2 },
+        { "sse41", cppcodec::simd_tier::sse41 },
+        { "SSE4.1", cppcodec::simd_tier::sse41 },
+        { "scalar", cppcodec::simd_tier::scalar },
+        { "Scalar", cppcodec::simd_tier::scalar },
+        { "sse4", cppcodec::simd_tier::scalar },
+        { "avx2 ", cppcodec::simd_tier::scalar },
+        { "avx", cppcodec::simd_tier::scalar },
+        { "off", cppcodec::simd_tier::scalar },
+        { "no-such-tier", cppcodec::simd_tier::scalar },
+    };
+    for (const auto& limit : limits) {
+        set_simd_tier_environment(limit.first);
+        REQUIRE(cppcodec::detail::simd_tier_limit_from_environment() == limit.second);
+    }
+    set_simd_tier_environment(original ? original_value.c_str() : nullptr);
+}
+
+template <typename Codec, typename Result>
+static void check_append(const std::vector<uint8_t>& binary)
+{
+    std::string encoded = Codec::encode(binary);
+
+    Result encoded_result;
+    encoded_result.push_back('>');
+    Codec::encode_append(encoded_result, binary);
+    Codec::encode_append(encoded_result, binary.data(), binary.size());
+    REQUIRE(std::string(encoded_result.begin(), encoded_result.end()) == ">" + encoded + encoded);
+
+    Result binary_result;
+    binary_result.push_back('>');
+    Codec::decode_append(binary_result, encoded);
+    Codec::decode_append(binary_result, encoded.data(), encoded.size());
+    std::string expected = ">" + std::string(binary.begin(), binary.end()) + std::string(binary.begin(), binary.end());
+    REQUIRE(std::string(binary_result.begin(), binary_result.end()) == expected);
+
+    // Invalid input leaves the previous contents untouched.
+    std::string invalid = encoded;
+    invalid[invalid.size() / 2] = '*';
+    REQUIRE_THROWS_AS(Codec::decode_append(binary_result, invalid), cppcodec::symbol_error);
+    REQUIRE(std::string(binary_result.begin(), binary_result.end()) == expected);
+}
+
+TEST_CASE("append to existing results", "[append]") {
+    std::vector<uint8_t> binary = make_test_data(1000);
+
+    SECTION("base64") {
+        check_append<cppcodec::base64_rfc4648, std::string>(binary);
+        check_append<cppcodec::base64_rfc4648, std::vector<char>>(binary);
+        check_append<cppcodec::base64_url_unpadded, std::deque<char>>(binary);
+    }
+    SECTION("base32") {
+        check_append<cppcodec::base32_rfc4648, std::string>(binary);
+        check_append<cppcodec::base32_crockford, std::vector<char>>(binary);
+        check_append<cppcodec::base32_hex, std::deque<char>>(binary);
+    }
+    SECTION("hex") {
+        check_append<cppcodec::hex_lower, std::string>(binary);
+        check_append<cppcodec::hex_upper, std::vector<char>>(binary);
+        check_append<cppcodec::hex_lower, std::deque<char>>(binary);
+    }
+}
+
+template <typename Codec>
+static void check_incremental_encoding(const std::vector<uint8_t>& binary)
+{
+    std::string expected = Codec::encode(binary);
+
+    for (size_t chunk_size = 1; chunk_size < 20; ++chunk_size) {
+        typename Codec::encoder encoder;
+        std::string encoded;
+        for (size_t offset = 0; offset < binary.size(); offset += chunk_size) {
+            encoder.update(&binary[offset], std::min(chunk_size, binary.size() - offset), encoded);
+            REQUIRE(encoder.pending_size() < 5); // less than a block
+        }
+        encoder.update(binary.data(), 0, encoded);
+        encoder.finish(encoded);
+        REQUIRE(encoded == expected);
+        REQUIRE(encoder.pending_size() == 0);
+
+        // Reusable after finish(), also with other input and result types.
+        std::vector<char> encoded_chars;
+        encoder.update(std::string(binary.begin(), binary.end()), encoded_chars);
+        encoder.finish(encoded_chars);
+        REQUIRE(std::string(encoded_chars.begin(), encoded_chars.end()) == expected);
+    }
+
+    typename Codec::encoder encoder;
+    std::string encoded;
+    encoder.finish(encoded);
+    REQUIRE(encoded.empty());
+}
+
+TEST_CASE("incremental encoding", "[incremental]") {
+    std::vector<uint8_t> binary = make_test_data(257);
+
+    SECTION("base64") {
+        check_incremental_encoding<cppcodec::base64_rfc4648>(binary);
+        check_incremental_encoding<cppcodec::base64_url_unpadded>(binary);
+    }
+    SECTION("base32") {
+        check_incremental_encoding<cppcodec::base32_rfc4648>(binary);
+        check_incremental_encoding<cppcodec::base32_crockford>(binary);
+    }
+    SECTION("hex") {
+        check_incremental_encoding<cppcodec::hex_lower>(binary);
+    }
+}
+
+// Decoded bytes, or the type of exception that was thrown.
+template <typename Codec>
+static std::string decode_outcome(const std::string& encoded, size_t chunk_size)
+{
+    std::string decoded;
+    try {
+        if (!chunk_size) {
+            Codec::decode(decoded, encoded);
+            return decoded;
+        }
+        typename Codec::decoder decoder;
+        for (size_t offset = 0; offset < encoded.size(); offset += chunk_size) {
+            decoder.update(encoded.data() + offset, std::min(chunk_size, encoded.size() - offset), decoded);
+        }
+        decoder.finish(decoded);
+        return decoded;
+    } catch (const std::exception& e) {
+        return std::string("exception: ") + typeid(e).name();
+    }
+}
+
+template <typename Codec>
+static void check_incremental_decoding(const std::string& extra_symbols)
+{
+    std::vector<std::string> inputs;
+    for (size_t size = 0; size < 12; ++size) {
+        std::string encoded = Codec::encode(make_test_data(size));
+        inputs.push_back(encoded);
+        inputs.push_back(encoded.substr(0, encoded.size() / 2));
+        for (char c : extra_symbols) {
+            inputs.push_back(encoded + c);
+            for (size_t i = 0; i < encoded.size(); i += 3) {
+                inputs.push_back(encoded.substr(0, i) + c + encoded.substr(i));
+            }
+        }
+    }
+    for (const std::string& input : inputs) {
+        std::string expected = decode_outcome<Codec>(input, 0);
+        for (size_t chunk_size = 1; chunk_size < 10; ++chunk_size) {
+            REQUIRE(decode_outcome<Codec>(input, chunk_size) == expected);
+        }
+    }
+
+    // Reusable after finish(), and after errors.
+    std::vector<uint8_t> binary = make_test_data(1000);
+    std::string encoded = Codec::encode(binary);
+    typename Codec::decoder decoder;
+    std::vector<uint8_t> decoded;
+    REQUIRE_THROWS_AS(decoder.update(std::string("*"), decoded), cppcodec::symbol_error);
+    REQUIRE(decoded.empty());
+    decoder.update(encoded.substr(0, 333), decoded);
+    decoder.update(encoded.substr(333), decoded);
+    decoder.finish(decoded);
+    REQUIRE(decoded == binary);
+}
+
+TEST_CASE("incremental decoding", "[incremental]") {
+    SECTION("base64") {
+        check_incremental_decoding<cppcodec::base64_rfc4648>(std::string("=*A\0", 4));
+        check_incremental_decoding<cppcodec::base64_url_unpadded>(std::string("=*A\0", 4));
+    }
+    SECTION("base32") {
+        check_incremental_decoding<cppcodec::base32_rfc4648>(std::string("=*A\0", 4));
+        check_incremental_decoding<cppcodec::base32_crockford>(std::string("=-*a\0", 5));
+    }
+    SECTION("hex") {
+        check_incremental_decoding<cppcodec::hex_lower>(std::string("=*a\0", 4));
+    }
+}
+
+template <typename Codec>
+static void check_try_decode(const std::string& extra_symbols)
+{
+    // Long inputs too, so that invalid characters are found by the vectorized scan of validate().
+    std::vector<size_t> sizes = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 100, 257 };
+    std::vector<std::string> inputs;
+    for (size_t size : sizes) {
+        std::string encoded = Codec::encode(make_test_data(size));
+        inputs.push_back(encoded);
+        inputs.push_back(encoded.substr(0, encoded.size() / 2));
+        for (char c : extra_symbols) {
+            inputs.push_back(encoded + c);
+            for (size_t i = 0; i < encoded.size(); i += (size < 12) ? 3 : 13) {
+                inputs.push_back(encoded.substr(0, i) + c + encoded.substr(i));
+            }
+        }
+    }
+    for (const std::string& input : inputs) {
+        std::vector<uint8_t> expected;
+        cppcodec::decode_error expected_error = cppcodec::decode_error::none;
+        char expected_symbol = 0;
+        try {
+            Codec::decode(expected, input);
+        } catch (const cppcodec::symbol_error& e) {
+            expected_error = cppcodec::decode_error::invalid_symbol;
+            expected_symbol = e.symbol();
+        } catch (const cppcodec::padding_error&) {
+            expected_error = cppcodec::decode_error::invalid_padding;
+        } catch (const cppcodec::invalid_input_length&) {
+            expected_error = cppcodec::decode_error::invalid_length;
+        }
+
+        std::vector<uint8_t> decoded;
+        cppcodec::decode_result result = Codec::try_decode(decoded, input);
+        REQUIRE(result.error == expected_error);
+        REQUIRE(result.size == decoded.size());
+        REQUIRE(static_cast<bool>(result) == (expected_error == cppcodec::decode_error::none));
+        if (result) {
+            REQUIRE(decoded == expected);
+            REQUIRE(result.error_offset == input.size());
+        } else {
+            REQUIRE(result.error_offset <= input.size());
+            REQUIRE(decoded.size() <= Codec::decoded_max_size(result.error_offset));
+        }
+        if (expected_error == cppcodec::decode_error::invalid_symbol) {
+            REQUIRE(input[result.error_offset] == expected_symbol);
+        }
+
+        std::vector<uint8_t> buffer(Codec::decoded_max_size(input.size()));
+        cppcodec::decode_result raw_result = Codec::try_decode(buffer.data(), buffer.size(), input);
+        REQUIRE(raw_result.error == result.error);
+        REQUIRE(raw_result.error_offset == result.error_offset);
+        REQUIRE(raw_result.size == result.size);
+        REQUIRE(std::equal(decoded.begin(), decoded.end(), buffer.begin()));
+
+        cppcodec::decode_result validated = Codec::validate(input);
+        REQUIRE(validated.error == result.error);
+        REQUIRE(validated.error_offset == result.error_offset);
+        REQUIRE(validated.size == result.size);
+
+        // Exact unless there's more input after an eof symbol.
+        REQUIRE(Codec::decoded_size(input) >= decoded.size());
+        REQUIRE(Codec::decoded_size(input) <= Codec::decoded_max_size(input.size()));
+        if (result && input.find('\0') == std::string::npos) {
+            REQUIRE(Codec::decoded_size(input) == decoded.size());
+        }
+    }
+}
+
+TEST_CASE("non-throwing decoding", "[try_decode][validate]") {
+    SECTION("base64") {
+        check_try_decode<cppcodec::base64_rfc4648>(std::string("=*A\0", 4));
+        check_try_decode<cppcodec::base64_url_unpadded>(std::string("=*A\0", 4));
+
+        std::string decoded;
+        cppcodec::decode_result result = cppcodec::base64_rfc4648::try_decode(decoded, std::string("Zm9v*mFy"));
+        REQUIRE(result.error == cppcodec::decode_error::invalid_symbol);
+        REQUIRE(result.error_offset == 4);
+        REQUIRE(decoded == "foo");
+
+        result = cppcodec::base64_rfc4648::try_decode(decoded, std::string("Zm9vZg==Zg=="));
+        REQUIRE(result.error == cppcodec::decode_error::invalid_padding);
+        REQUIRE(result.error_offset == 8);
+        REQUIRE(decoded == "foo");
+
+        result = cppcodec::base64_url_unpadded::try_decode(decoded, std::string("Zm9vY"));
+        REQUIRE(result.error == cppcodec::decode_error::invalid_length);
+        REQUIRE(result.error_offset == 5);
+        REQUIRE(decoded == "foo");
+    }
+    SECTION("base32") {
+        check_try_decode<cppcodec::base32_rfc4648>(std::string("=*A\0", 4));
+        check_try_decode<cppcodec::base32_crockford>(std::string("=-*a\0", 5));
+    }
+    SECTION("hex") {
+        check_try_decode<cppcodec::hex_lower>(std::string("=*a\0", 4));
+
+        uint8_t buffer[2];
+        cppcodec::decode_result result = cppcodec::hex_lower::try_decode(buffer, sizeof(buffer), "abc", 3);
+        REQUIRE(result.error == cppcodec::decode_error::invalid_length);
+        REQUIRE(result.error_offset == 3);
+        REQUIRE(result.size == 1);
+        REQUIRE(buffer[0] == 0xab);
+    }
+}
+
+TEST_CASE("exact decoded size", "[decoded_size]") {
+    SECTION("base64") {
+        using base64 = cppcodec::base64_rfc4648;
+        REQUIRE(base64::decoded_size(std::string("")) == 0);
+        REQUIRE(base64::decoded_size(std::string("Zg==")) == 1);
+        REQUIRE(base64::decoded_size(std::string("Zm8=")) == 2);
+        REQUIRE(base64::decoded_size(std::string("Zm9v")) == 3);
+        REQUIRE(base64::decoded_size("Zm9vYg==") == 4); // including the eof symbol of the literal
+        REQUIRE(cppcodec::base64_url_unpadded::decoded_size(std::string("Zm9vYg")) == 4);
+
+        // Raw buffers only need to be large enough for the actual data.
+        uint8_t buffer[4];
+        REQUIRE(base64::decode(buffer, sizeof(buffer), std::string("Zm9vYg==")) == 4);
+        REQUIRE(memcmp(buffer, "foob", 4) == 0);
+    }
+    SECTION("base32") {
+        using crockford = cppcodec::base32_crockford;
+        REQUIRE(cppcodec::base32_rfc4648::decoded_size(std::string("MZXW6===")) == 3);
+        REQUIRE(crockford::decoded_size(std::string("CSQPY")) == 3);
+        REQUIRE(crockford::decoded_size(std::string("C-S-Q-P-Y")) == 3);
+        REQUIRE(crockford::decoded_size(std::string("--")) == 0);
+
+        std::vector<uint8_t> decoded;
+        crockford::decode(decoded, std::string("CS-QP-Y"));
+        REQUIRE(decoded == std::vector<uint8_t>({ 'f', 'o', 'o' }));
+    }
+    SECTION("hex") {
+        REQUIRE(cppcodec::hex_lower::decoded_size(std::string("666f6f")) == 3);
+        REQUIRE(cppcodec::hex_upper::decoded_size("666F6F") == 3);
+    }
+}
+
+template <typename Codec>
+static void check_parallel_encoding()
+{
+    // Around the chunk count where encoding switches from serial to parallel.
+    std::vector<size_t> sizes = { 0, 1, cppcodec::parallel_chunk_size + 1,
+            2 * cppcodec::parallel_chunk_size - 1, 2 * cppcodec::parallel_chunk_size,
+            5 * cppcodec::parallel_chunk_size + 7 };
+    cppcodec::thread_pool pool(3);
+    for (size_t size : sizes) {
+        std::vector<uint8_t> binary = make_test_data(size);
+        std::string expected = Codec::encode(binary);
+
+        std::string encoded;
+        cppcodec::encode_parallel<Codec>(encoded, binary);
+        REQUIRE(encoded == expected);
+
+        std::vector<uint8_t> encoded_vector;
+        cppcodec::encode_parallel<Codec>(encoded_vector, binary.data(), binary.size(), pool);
+        REQUIRE(std::string(encoded_vector.begin(), encoded_vector.end()) == expected);
+
+        // Results without direct access are encoded serially.
+        size_t num_tasks = 0;
+        if (size == 2 * cppcodec::parallel_chunk_size) {
+            std::deque<char> encoded_deque;
+            cppcodec::encode_parallel<Codec>(encoded_deque, binary, [&](size_t n, const cppcodec::parallel_task&) {
+                num_tasks += n;
+            });
+            REQUIRE(std::string(encoded_deque.begin(), encoded_deque.end()) == expected);
+            REQUIRE(num_tasks == 0);
+        }
+
+        // Chunks can be run in any order.
+        encoded.clear();
+        cppcodec::encode_parallel<Codec>(encoded, binary, [&](size_t n, const cppcodec::parallel_task& task) {
+            num_tasks += n;
+            for (size_t i = n; i > 0; --i) {
+                task(i - 1);
+            }
+        });
+        REQUIRE(encoded == expected);
+        if (size <= cppcodec::parallel_chunk_size) {
+            REQUIRE(num_tasks == 0);
+        } else if (size >= 2 * cppcodec::parallel_chunk_size) {
+            REQUIRE(num_tasks >= 2);
+        }
+    }
+}
+
+TEST_CASE("parallel encoding", "[parallel]") {
+    SECTION("base64") {
+        check_parallel_encoding<cppcodec::base64_rfc4648>();
+        check_parallel_encoding<cppcodec::base64_url_unpadded>();
+    }
+    SECTION("base32") {
+        check_parallel_encoding<cppcodec::base32_crockford>();
+    }
+    SECTION("hex") {
+        check_parallel_encoding<cppcodec::hex_lower>();
+    }
+    SECTION("thread pool") {
+        cppcodec::thread_pool pool(4);
+        REQUIRE(pool.num_threads() == 4);
+        for (size_t num_tasks : { 0, 1, 2, 100 }) {
+            std::vector<std::atomic<int>> runs(num_tasks);
+            for (std::atomic<int>& r : runs) {
+                r = 0;
+            }
+            pool(num_tasks, [&](size_t i) { ++runs[i]; });
+            for (std::atomic<int>& r : runs) {
+                REQUIRE(r == 1);
+            }
+        }
+    }
+}
+
+template <typename Codec>
+static std::string parallel_decode_outcome(const std::string& encoded)
+{
+    std::vector<uint8_t> decoded;
+    try {
+        cppcodec::decode_parallel<Codec>(decoded, encoded);
+    } catch (const cppcodec::symbol_error& e) {
+        return std::string("symbol_error ") + e.symbol();
+    } catch (const cppcodec::parse_error& e) {
+        return std::string("parse_error ") + e.what();
+    }
+    return std::string(decoded.begin(), decoded.end());
+}
+
+template <typename Codec>
+static std::string serial_decode_outcome(const std::string& encoded)
+{
+    std::vector<uint8_t> decoded;
+    try {
+        Codec::decode(decoded, encoded);
+    } catch (const cppcodec::symbol_error& e) {
+        return std::string("symbol_error ") + e.symbol();
+    } catch (const cppcodec::parse_error& e) {
+        return std::string("parse_error ") + e.what();
+    }
+    return std::string(decoded.begin(), decoded.end());
+}
+
+template <typename Codec>
+static void check_parallel_decoding(char extra_symbol)
+{
+    std::vector<size_t> sizes = { 0, 1, cppcodec::parallel_chunk_size + 7 };
+    for (size_t size : sizes) {
+        std::vector<uint8_t> binary = make_test_data(size);
+        std::string encoded = Codec::encode(binary);
+
+        std::vector<uint8_t> decoded;
+        cppcodec::decode_parallel<Codec>(decoded, encoded);
+        REQUIRE(decoded == binary);
+
+        std::string decoded_string;
+        cppcodec::thread_pool pool(3);
+        cppcodec::decode_parallel<Codec>(decoded_string, encoded, pool);
+        REQUIRE(decoded_string == std::string(binary.begin(), binary.end()));
+
+        if (size < cppcodec::parallel_chunk_size) {
+            continue;
+        }
+        // Extra (ignored or invalid) characters shift blocks across chunk boundaries,
+        // and in some places change how the input gets split into parts.
+        std::vector<std::string> inputs;
+        for (size_t step : { size_t(7), size_t(1000), cppcodec::parallel_chunk_size - 3 }) {
+            std::string input;
+            for (size_t i = 0; i < encoded.size(); i += step) {
+                input += encoded.substr(i, step);
+                input += extra_symbol;
+            }
+            inputs.push_back(input);
+        }
+        inputs.push_back(encoded + encoded); // padding in the middle, for padded variants
+        inputs.push_back(encoded.substr(0, encoded.size() - 1));
+        inputs.push_back(encoded.substr(0, cppcodec::parallel_chunk_size + 1) + '*' + encoded);
+        inputs.push_back(encoded + std::string(1, '\0') + "***");
+        inputs.push_back(encoded.substr(0, cppcodec::parallel_chunk_size / 2) + std::string(1, '\0') + encoded);
+        inputs.push_back(std::string(2 * cppcodec::parallel_chunk_size, extra_symbol));
+        for (const std::string& input : inputs) {
+            REQUIRE(parallel_decode_outcome<Codec>(input) == serial_decode_outcome<Codec>(input));
+        }
+    }
+}
+
+TEST_CASE("parallel decoding", "[parallel]") {
+    SECTION("base64") {
+        check_parallel_decoding<cppcodec::base64_rfc4648>('*');
+        check_parallel_decoding<cppcodec::base64_url_unpadded>('=');
+    }
+    SECTION("base32") {
+        check_parallel_decoding<cppcodec::base32_rfc4648>('=');
+        check_parallel_decoding<cppcodec::base32_crockford>('-');
+    }
+    SECTION("hex") {
+        check_parallel_decoding<cppcodec::hex_lower>('*');
+    }
+    SECTION("custom executor") {
+        std::string unhyphenated = cppcodec::base32_crockford::encode(make_test_data(cppcodec::parallel_chunk_size));
+        std::string encoded;
+        for (size_t i = 0; i < unhyphenated.size(); i += 3) {
+            encoded += unhyphenated.substr(i, 3) + '-';
+        }
+        // Parts can be decoded in any order.
+        size_t num_calls = 0;
+        std::vector<uint8_t> decoded;
+        cppcodec::decode_parallel<cppcodec::base32_crockford>(decoded, encoded,
+                [&](size_t n, const cppcodec::parallel_task& task) {
+            ++num_calls;
+            for (size_t i = n; i > 0; --i) {
+                task(i - 1);
+            }
+        });
+        REQUIRE(num_calls == 2);
+        REQUIRE(decoded == make_test_data(cppcodec::parallel_chunk_size));
+
+        // Results without direct access are decoded serially, without counting in parallel first.
+        num_calls = 0;
+        std::deque<uint8_t> decoded_deque;
+        cppcodec::decode_parallel<cppcodec::base32_crockford>(decoded_deque, encoded,
+                [&](size_t, const cppcodec::parallel_task&) { ++num_calls; });
+        REQUIRE(num_calls == 0);
+        REQUIRE(std::vector<uint8_t>(decoded_deque.begin(), decoded_deque.end()) == decoded);
+        REQUIRE(cppcodec::data::has_span<cppcodec::data::raw_result_buffer>());
+        REQUIRE(!cppcodec::data::has_span<std::deque<uint8_t>>());
+    }
+}
+
+template <typename Codec>
+static void check_batch_encoding()
+{
+    std::vector<std::vector<uint8_t>> binaries;
+    for (size_t size : { 0, 1, 16, 0, 32, 33, 64, 1000, 2 }) {
+        binaries.push_back(make_test_data(size));
+    }
+    std::string expected;
+    std::vector<size_t> expected_offsets(1, 0);
+    for (const std::vector<uint8_t>& binary : binaries) {
+        expected += Codec::encode(binary);
+        expected_offsets.push_back(expected.size());
+    }
+
+    std::string encoded = "previous contents";
+    std::vector<size_t> offsets(2, 42);
+    Codec::encode_batch(encoded, offsets, binaries);
+    REQUIRE(encoded == expected);
+    REQUIRE(offsets == expected_offsets);
+
+    std::vector<const uint8_t*> pointers;
+    std::vector<size_t> sizes;
+    for (const std::vector<uint8_t>& binary : binaries) {
+        pointers.push_back(binary.data());
+        sizes.push_back(binary.size());
+    }
+    std::deque<char> encoded_deque;
+    std::vector<uint32_t> offsets32;
+    Codec::encode_batch(encoded_deque, offsets32, pointers.data(), sizes.data(), pointers.size());
+    REQUIRE(std::string(encoded_deque.begin(), encoded_deque.end()) == expected);
+    REQUIRE(std::vector<size_t>(offsets32.begin(), offsets32.end()) == expected_offsets);
+
+    Codec::encode_batch(encoded, offsets, std::vector<std::string>());
+    REQUIRE(encoded.empty());
+    REQUIRE(offsets == std::vector<size_t>(1, 0));
+}
+
+TEST_CASE("batch encoding", "[batch]") {
+    SECTION("base64") {
+        check_batch_encoding<cppcodec::base64_rfc4648>();
+        check_batch_encoding<cppcodec::base64_url_unpadded>();
+    }
+    SECTION("base32") {
+        check_batch_encoding<cppcodec::base32_crockford>();
+        check_batch_encoding<cppcodec::base32_rfc4648>();
+    }
+    SECTION("hex") {
+        check_batch_encoding<cppcodec::hex_upper>();
+    }
+}
+
+template <typename Codec>
+static void check_batch_decoding(const std::string& invalid)
+{
+    std::vector<std::string> encodeds;
+    for (size_t size : { 0, 1, 16, 0, 32, 33, 64, 1000, 2 }) {
+        encodeds.push_back(Codec::encode(make_test_data(size)));
+    }
+    encodeds.insert(encodeds.begin() + 2, invalid);
+    encodeds.insert(encodeds.begin() + 5, encodeds[6] + invalid);
+    encodeds.push_back(invalid);
+
+    std::vector<uint8_t> expected;
+    std::vector<size_t> expected_offsets(1, 0);
+    std::vector<cppcodec::decode_result> expected_results;
+    for (const std::string& encoded : encodeds) {
+        std::vector<uint8_t> decoded;
+        cppcodec::decode_result result = Codec::try_decode(decoded, encoded);
+        if (result) {
+            expected.insert(expected.end(), decoded.begin(), decoded.end());
+        }
+        expected_offsets.push_back(expected.size());
+        expected_results.push_back(result);
+    }
+
+    std::vector<uint8_t> decoded = make_test_data(10);
+    std::vector<size_t> offsets;
+    std::vector<cppcodec::decode_result> results;
+    REQUIRE(Codec::decode_batch(decoded, offsets, results, encodeds) == 3);
+    REQUIRE(decoded == expected);
+    REQUIRE(offsets == expected_offsets);
+    REQUIRE(results.size() == expected_results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        REQUIRE(results[i].error == expected_results[i].error);
+        REQUIRE(results[i].error_offset == expected_results[i].error_offset);
+        REQUIRE(results[i].size == expected_results[i].size);
+    }
+
+    std::vector<const char*> pointers;
+    std::vector<size_t> sizes;
+    for (const std::string& encoded : encodeds) {
+        pointers.push_back(encoded.data());
+        sizes.push_back(encoded.size());
+    }
+    std::deque<uint8_t> decoded_deque;
+    std::vector<uint32_t> offsets32;
+    REQUIRE(Codec::decode_batch(decoded_deque, offsets32, results,
+            pointers.data(), sizes.data(), pointers.size()) == 3);
+    REQUIRE(std::vector<uint8_t>(decoded_deque.begin(), decoded_deque.end()) == expected);
+    REQUIRE(std::vector<size_t>(offsets32.begin(), offsets32.end()) == expected_offsets);
+
+    REQUIRE(Codec::decode_batch(decoded, offsets, results, std::vector<std::string>()) == 0);
+    REQUIRE(decoded.empty());
+    REQUIRE(offsets == std::vector<size_t>(1, 0));
+    REQUIRE(results.empty());
+}
+
+TEST_CASE("batch decoding", "[batch]") {
+    SECTION("base64") {
+        check_batch_decoding<cppcodec::base64_rfc4648>("Zg");
+        check_batch_decoding<cppcodec::base64_url_unpadded>("Z*g");
+    }
+    SECTION("base32") {
+        check_batch_decoding<cppcodec::base32_crockford>("C-S-Q-P-Y-U");
+        check_batch_decoding<cppcodec::base32_rfc4648>("MY======MY");
+    }
+    SECTION("hex") {
+        check_batch_decoding<cppcodec::hex_upper>("6");
+    }
+}
+
+template <typename Codec, size_t N>
+static void check_fixed_size()
+{
+    std::vector<uint8_t> binary = make_test_data(N);
+    uint8_t binary_array[N];
+    std::array<uint8_t, N> binary_std_array;
+    std::copy(binary.begin(), binary.end(), binary_array);
+    std::copy(binary.begin(), binary.end(), binary_std_array.begin());
+    std::string expected = Codec::encode(binary);
+
+    std::array<char, Codec::encoded_size(N)> encoded = Codec::template encode<N>(binary_array);
+    REQUIRE(std::string(encoded.begin(), encoded.end()) == expected);
+    encoded = Codec::template encode<N>(binary_std_array);
+    REQUIRE(std::string(encoded.begin(), encoded.end()) == expected);
+
+    REQUIRE(Codec::template decode<N>(expected) == binary_std_array);
+    REQUIRE(Codec::template decode<N>(expected.data(), expected.size()) == binary_std_array);
+    REQUIRE(Codec::template decode<N>(expected + std::string(1, '\0') + "*") == binary_std_array);
+    REQUIRE_THROWS_AS(Codec::template decode<N>(expected + expected), cppcodec::invalid_input_length);
+    std::string invalid = expected;
+    invalid[0] = '*';
+    REQUIRE_THROWS_AS(Codec::template decode<N>(invalid), cppcodec::symbol_error);
+    REQUIRE_THROWS_AS(Codec::template decode<N + 1>(expected), cppcodec::invalid_input_length);
+}
+
+template <typename Codec>
+static void check_fixed_sizes()
+{
+    check_fixed_size<Codec, 1>();
+    check_fixed_size<Codec, 2>();
+    check_fixed_size<Codec, 3>();
+    check_fixed_size<Codec, 4>();
+    check_fixed_size<Codec, 16>();
+    check_fixed_size<Codec, 20>();
+    check_fixed_size<Codec, 32>();
+    check_fixed_size<Codec, 64>();
+    check_fixed_size<Codec, 100>();
+}
+
+TEST_CASE("fixed-size encoding and decoding", "[fixed_size]") {
+    SECTION("base64") {
+        check_fixed_sizes<cppcodec::base64_rfc4648>();
+        check_fixed_sizes<cppcodec::base64_url_unpadded>();
+    }
+    SECTION("base32") {
+        check_fixed_sizes<cppcodec::base32_crockford>();
+        check_fixed_sizes<cppcodec::base32_rfc4648>();
+
+        // Not a regular encoding, decoded without the fixed-size shortcut.
+        REQUIRE(cppcodec::base32_crockford::decode<3>(std::string("cs-qpy")) == (std::array<uint8_t, 3>{ { 'f', 'o', 'o' } }));
+    }
+    SECTION("hex") {
+        check_fixed_sizes<cppcodec::hex_lower>();
+    }
+    SECTION("empty") {
+        std::array<uint8_t, 0> empty;
+        REQUIRE(cppcodec::base64_rfc4648::encode<0>(empty).empty());
+        REQUIRE(cppcodec::base64_rfc4648::decode<0>(std::string()).empty());
+        REQUIRE_THROWS_AS(cppcodec::base64_rfc4648::decode<0>(std::string("Zg==")), cppcodec::invalid_input_length);
+    }
+    SECTION("unchanged overloads") {
+        // Without an explicit size, arrays are still encoded into strings.
+        std::array<uint8_t, 3> foo = { { 'f', 'o', 'o' } };
+        REQUIRE(cppcodec::base64_rfc4648::encode(foo) == "Zm9v");
+        REQUIRE(cppcodec::base64_rfc4648::decode<std::string>(std::string("Zm9v")) == "foo");
+    }
+}